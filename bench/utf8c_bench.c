@@ -0,0 +1,630 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Throughput benchmark of utf8c functions over generated corpora.
+ * Usage: utf8c_bench [--format text|csv|json] [--max-size OCTETS] [--min-time SECONDS] [--filter NAME]*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <utf8c.h>
+
+#ifndef UTF8C_BENCH_MAX_SIZE
+#define UTF8C_BENCH_MAX_SIZE (16UL * 1024 * 1024)
+#endif
+
+/* Functions that allocate per code point get slow and memory hungry on big corpora*/
+#define PER_CP_MAX_SIZE (1UL * 1024 * 1024)
+
+/* Allocator that counts calls and requested octets*/
+typedef struct counting_ctx {
+    size_t allocs;
+    size_t bytes;
+} counting_ctx;
+
+static void *counting_alloc(void *ctx, size_t size) {
+    ((counting_ctx *) ctx)->allocs++;
+    ((counting_ctx *) ctx)->bytes += size;
+    return malloc(size);
+}
+
+static void *counting_resize(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    ((counting_ctx *) ctx)->allocs++;
+    if (new_size > old_size) {
+        ((counting_ctx *) ctx)->bytes += new_size - old_size;
+    }
+    return realloc(ptr, new_size);
+}
+
+static void counting_release(void *ctx, void *ptr) {
+    (void) ctx;
+    free(ptr);
+}
+
+/* Everything a benchmarked call may need*/
+typedef struct bench_ctx {
+    const char *str;        /* Corpus*/
+    size_t len;             /* Number of octets in `str`*/
+    size_t n_cps;           /* Number of code points in `str`*/
+    char *scratch;          /* Buffer of `len` + 1 octets*/
+    void *units;            /* Buffer of `len` utf-32 code units*/
+    utf8_char16 *utf16;     /* `str` in utf-16*/
+    size_t utf16_len;
+    size_t *offsets;        /* `str` cut into a column of short strings, see utf8_distance_batch*/
+    size_t n_strings;
+    utf8_allocator alloc;   /* Counting allocator*/
+    counting_ctx counts;
+} bench_ctx;
+
+/* Results are accumulated here, so calls can't be optimized out*/
+static volatile size_t sink;
+
+static void bench_distance(bench_ctx *ctx) {
+    sink += utf8_distance(ctx->str, ctx->str + ctx->len);
+}
+
+static void bench_advance(bench_ctx *ctx) {
+    sink += (size_t) (utf8_advance(ctx->str, ctx->n_cps / 2, ctx->str + ctx->len) - ctx->str);
+}
+
+static void bench_validate(bench_ctx *ctx) {
+    sink += (size_t) utf8_validate(ctx->str, ctx->str + ctx->len, NULL);
+}
+
+static void bench_strcpy(bench_ctx *ctx) {
+    char *res;
+
+    res = utf8_strcpy_a(&ctx->alloc, ctx->str, ctx->len, NULL);
+    sink += (size_t) res[0];
+    ctx->alloc.release(ctx->alloc.ctx, res);
+}
+
+static void bench_substr(bench_ctx *ctx) {
+    char *res;
+    size_t len;
+
+    res = utf8_substr_a(&ctx->alloc, ctx->str, ctx->len, ctx->n_cps / 4, ctx->n_cps / 2, &len);
+    sink += len;
+    ctx->alloc.release(ctx->alloc.ctx, res);
+}
+
+static void bench_reverse(bench_ctx *ctx) {
+    sink += (size_t) utf8_reverse_n(ctx->scratch, ctx->len)[0];
+}
+
+static void bench_reverse_to(bench_ctx *ctx) {
+    sink += (size_t) utf8_reverse_to(ctx->str, ctx->len, ctx->scratch)[0];
+}
+
+static void bench_join(bench_ctx *ctx) {
+    char *res;
+    size_t len;
+
+    res = utf8_join_a(&ctx->alloc, ctx->str, ctx->len, "-", 1, &len);
+    sink += len;
+    ctx->alloc.release(ctx->alloc.ctx, res);
+}
+
+static void bench_repeat(bench_ctx *ctx) {
+    char *res;
+    size_t len;
+
+    res = utf8_repeat_a(&ctx->alloc, ctx->str, ctx->len, 4, &len);
+    sink += len;
+    ctx->alloc.release(ctx->alloc.ctx, res);
+}
+
+static void bench_strcat(bench_ctx *ctx) {
+    char *res;
+    size_t len;
+
+    res = utf8_strcat_a(&ctx->alloc, ctx->str, ctx->len, ctx->str, ctx->len, &len);
+    sink += len;
+    ctx->alloc.release(ctx->alloc.ctx, res);
+}
+
+static void bench_to_arr(bench_ctx *ctx) {
+    char **arr;
+    size_t count;
+
+    arr = utf8_to_arr_a(&ctx->alloc, ctx->str, ctx->len, &count);
+    sink += count;
+    utf8_arr_free_a(&ctx->alloc, arr);
+}
+
+static void bench_to_arr_flat(bench_ctx *ctx) {
+    char **arr;
+    size_t count;
+
+    arr = utf8_to_arr_flat_a(&ctx->alloc, ctx->str, ctx->len, &count);
+    sink += count;
+    ctx->alloc.release(ctx->alloc.ctx, arr);
+}
+
+static void bench_grapheme_count(bench_ctx *ctx) {
+    sink += utf8_grapheme_count(ctx->str, ctx->str + ctx->len);
+}
+
+static void bench_index(bench_ctx *ctx) {
+    utf8_index *index;
+
+    index = utf8_index_create_a(&ctx->alloc, ctx->str, ctx->len, UTF8_INDEX_STEP);
+    sink += (size_t) (utf8_index_advance(index, ctx->n_cps / 2) - ctx->str);
+    utf8_index_free(index);
+}
+
+static void bench_builder(bench_ctx *ctx) {
+    utf8_builder builder;
+    size_t off, n;
+
+    /* Appends the corpus in pieces of 64 octets, as if it was assembled from tokens*/
+    utf8_builder_init(&builder, &ctx->alloc);
+    for (off = 0; off < ctx->len; off += n) {
+        n = (ctx->len - off < 64) ? ctx->len - off : 64;
+        utf8_builder_append(&builder, ctx->str + off, n);
+    }
+    sink += builder.len;
+    utf8_builder_free(&builder);
+}
+
+static void bench_stream(bench_ctx *ctx) {
+    utf8_stream stream;
+    size_t off, n;
+
+    utf8_stream_init(&stream);
+    for (off = 0; off < ctx->len; off += n) {
+        n = (ctx->len - off < 65536) ? ctx->len - off : 65536;
+        sink += utf8_stream_feed(&stream, ctx->str + off, n);
+    }
+    sink += (size_t) utf8_stream_finish(&stream) + stream.n_cps;
+}
+
+static void bench_to_utf32(bench_ctx *ctx) {
+    sink += utf8_to_utf32(ctx->str, ctx->len, (utf8_char32 *) ctx->units, ctx->len);
+}
+
+static void bench_to_utf16(bench_ctx *ctx) {
+    sink += utf8_to_utf16(ctx->str, ctx->len, (utf8_char16 *) ctx->units, ctx->len);
+}
+
+static void bench_from_utf16(bench_ctx *ctx) {
+    sink += utf8_from_utf16(ctx->utf16, ctx->utf16_len, ctx->scratch, ctx->len);
+}
+
+static void bench_distance_mt(bench_ctx *ctx) {
+    sink += utf8_distance_mt(NULL, ctx->str, ctx->str + ctx->len);
+}
+
+static void bench_validate_mt(bench_ctx *ctx) {
+    sink += (size_t) utf8_validate_mt(NULL, ctx->str, ctx->str + ctx->len, NULL);
+}
+
+static void bench_to_utf32_mt(bench_ctx *ctx) {
+    sink += utf8_to_utf32_mt(NULL, ctx->str, ctx->len, (utf8_char32 *) ctx->units, ctx->len);
+}
+
+static void bench_distance_each(bench_ctx *ctx) {
+    size_t i;
+
+    for (i = 0; i < ctx->n_strings; i++) {
+        sink += utf8_distance(ctx->str + ctx->offsets[i], ctx->str + ctx->offsets[i + 1]);
+    }
+}
+
+static void bench_distance_batch(bench_ctx *ctx) {
+    utf8_distance_batch(ctx->str, ctx->offsets, ctx->n_strings, (size_t *) ctx->units);
+    sink += ((size_t *) ctx->units)[0];
+}
+
+static void bench_validate_batch(bench_ctx *ctx) {
+    sink += utf8_validate_batch(ctx->str, ctx->offsets, ctx->n_strings, (size_t *) ctx->units);
+}
+
+static void bench_substr_batch(bench_ctx *ctx) {
+    utf8_substr_batch(ctx->str, ctx->offsets, ctx->n_strings, 2, 8, ctx->scratch, (size_t *) ctx->units);
+    sink += ((size_t *) ctx->units)[ctx->n_strings];
+}
+
+static void bench_view_substr(bench_ctx *ctx) {
+    sink += utf8_view_substr(utf8_view_n(ctx->str, ctx->len), ctx->n_cps / 4, ctx->n_cps / 2).len;
+}
+
+static void bench_is_nfc(bench_ctx *ctx) {
+    sink += (size_t) utf8_is_nfc(ctx->str, ctx->len);
+}
+
+static void bench_nfd_into(bench_ctx *ctx) {
+    sink += utf8_normalize_nfd_into(ctx->scratch, ctx->len + 1, ctx->str, ctx->len);
+}
+
+static void bench_casefold_into(bench_ctx *ctx) {
+    sink += utf8_casefold_into(ctx->scratch, ctx->len + 1, ctx->str, ctx->len);
+}
+
+static void bench_find(bench_ctx *ctx) {
+    size_t off;
+
+    /* Not in any corpus, so the whole string is searched and counted*/
+    sink += (size_t) utf8_find(ctx->str, ctx->len, "needle\xf0\x9f\xa7\xb7", 10, &off);
+}
+
+static void bench_split(bench_ctx *ctx) {
+    utf8_split split;
+    utf8_view word;
+
+    utf8_split_init_set(&split, ctx->str, ctx->len, " \t\n", 3, UTF8_SPLIT_SKIP_EMPTY);
+    while (utf8_split_next(&split, &word)) {
+        sink += word.len;
+    }
+}
+
+static void bench_sanitize(bench_ctx *ctx) {
+    /* Whatever the other cases leave in scratch is valid, so this is the validation pre-scan alone*/
+    sink += utf8_sanitize(ctx->scratch, ctx->len, ctx->len + 1);
+}
+
+typedef struct bench_case {
+    const char *name;
+    void (*run)(bench_ctx *ctx);
+    size_t max_size;    /* Largest corpus to run on, 0 means no limit*/
+} bench_case;
+
+static const bench_case cases[] = {
+        {"distance",       bench_distance,       0},
+        {"advance",        bench_advance,        0},
+        {"validate",       bench_validate,       0},
+        {"strcpy",         bench_strcpy,         0},
+        {"substr",         bench_substr,         0},
+        {"reverse",        bench_reverse,        0},
+        {"reverse_to",     bench_reverse_to,     0},
+        {"join",           bench_join,           0},
+        {"repeat",         bench_repeat,         0},
+        {"strcat",         bench_strcat,         0},
+        {"to_arr",         bench_to_arr,         PER_CP_MAX_SIZE},
+        {"to_arr_flat",    bench_to_arr_flat,    0},
+        {"grapheme_count", bench_grapheme_count, 0},
+        {"index",          bench_index,          0},
+        {"builder",        bench_builder,        0},
+        {"stream",         bench_stream,         0},
+        {"to_utf32",       bench_to_utf32,       0},
+        {"to_utf16",       bench_to_utf16,       0},
+        {"from_utf16",     bench_from_utf16,     0},
+        {"distance_mt",    bench_distance_mt,    0},
+        {"validate_mt",    bench_validate_mt,    0},
+        {"to_utf32_mt",    bench_to_utf32_mt,    0},
+        {"distance_each",  bench_distance_each,  0},
+        {"distance_batch", bench_distance_batch, 0},
+        {"validate_batch", bench_validate_batch, 0},
+        {"substr_batch",   bench_substr_batch,   0},
+        {"view_substr",    bench_view_substr,    0},
+        {"is_nfc",         bench_is_nfc,         0},
+        {"nfd_into",       bench_nfd_into,       0},
+        {"casefold_into",  bench_casefold_into,  0},
+        {"find",           bench_find,           0},
+        {"split",          bench_split,          0},
+        {"sanitize",       bench_sanitize,       0}
+};
+
+/* Deterministic, so that runs on the same machine compare*/
+static unsigned long rng_state = 1;
+
+static unsigned long rnd(unsigned long n) {
+    rng_state = (rng_state * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+    return (rng_state >> 8) % n;
+}
+
+static size_t put_cp(char *dst, unsigned long cp) {
+    if (cp < 0x80) {
+        dst[0] = (char) cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        dst[0] = (char) (0xC0 | (cp >> 6));
+        dst[1] = (char) (0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        dst[0] = (char) (0xE0 | (cp >> 12));
+        dst[1] = (char) (0x80 | ((cp >> 6) & 0x3F));
+        dst[2] = (char) (0x80 | (cp & 0x3F));
+        return 3;
+    }
+    dst[0] = (char) (0xF0 | (cp >> 18));
+    dst[1] = (char) (0x80 | ((cp >> 12) & 0x3F));
+    dst[2] = (char) (0x80 | ((cp >> 6) & 0x3F));
+    dst[3] = (char) (0x80 | (cp & 0x3F));
+    return 4;
+}
+
+/* Longest word: 8 emoji with a flag each and a separator*/
+#define WORD_MAX 128
+
+enum {
+    WORD_ASCII, WORD_CYRILLIC, WORD_CJK, WORD_EMOJI
+};
+
+/* Writes a word of the given script followed by a separator, `dst` must have room for WORD_MAX octets*/
+static size_t put_word(char *dst, int script) {
+    size_t len, n, i;
+
+    len = 0;
+    n = 1 + rnd(8);
+    for (i = 0; i < n; i++) {
+        switch (script) {
+            case WORD_ASCII:
+                len += put_cp(dst + len, 'a' + rnd(26));
+                break;
+            case WORD_CYRILLIC:
+                len += put_cp(dst + len, 0x430 + rnd(32));
+                break;
+            case WORD_CJK:
+                len += put_cp(dst + len, 0x4E00 + rnd(0x5200));
+                break;
+            default:
+                len += put_cp(dst + len, 0x1F600 + rnd(0x50));
+                if (rnd(5) == 0) { /* Skin tone modifier*/
+                    len += put_cp(dst + len, 0x1F3FB + rnd(5));
+                } else if (rnd(10) == 0) { /* ZWJ sequence*/
+                    len += put_cp(dst + len, 0x200D);
+                    len += put_cp(dst + len, 0x1F4BB);
+                } else if (rnd(10) == 0) { /* Flag*/
+                    len += put_cp(dst + len, 0x1F1E6 + rnd(26));
+                    len += put_cp(dst + len, 0x1F1E6 + rnd(26));
+                }
+                break;
+        }
+    }
+    if (script != WORD_CJK) {
+        len += put_cp(dst + len, (rnd(12) == 0) ? '\n' : ' ');
+    } else if (rnd(4) == 0) { /* CJK has no spaces between words, only an occasional full stop*/
+        len += put_cp(dst + len, 0x3002);
+    }
+    return len;
+}
+
+typedef struct corpus {
+    const char *name;
+    int weights[4]; /* Chance of a word of every script, in percent*/
+} corpus;
+
+static const corpus corpora[] = {
+        {"ascii",    {100, 0,   0,   0}},
+        {"cyrillic", {5,   95,  0,   0}},
+        {"cjk",      {5,   0,   95,  0}},
+        {"emoji",    {30,  0,   0,   70}},
+        {"mixed",    {55,  20,  15,  10}}
+};
+
+/* Fills `dst` with exactly `size` octets of words, padding with spaces*/
+static void generate(char *dst, size_t size, const corpus *c) {
+    char word[WORD_MAX];
+    size_t len, n;
+    unsigned long r;
+    int script;
+
+    rng_state = 1;
+    len = 0;
+    for (;;) {
+        r = rnd(100);
+        for (script = 0; script < 3 && r >= (unsigned long) c->weights[script]; script++) {
+            r -= (unsigned long) c->weights[script];
+        }
+        n = put_word(word, script);
+        if (size - len < n) {
+            break;
+        }
+        memcpy(dst + len, word, n);
+        len += n;
+    }
+    memset(dst + len, ' ', size - len);
+    dst[size] = '\0';
+}
+
+/* Cuts `str` into strings of 8 to 24 octets on code point boundaries, like a column of names or tags.
+ * `offsets` must hold `len` / 8 + 2 elements
+ * return   - number of strings*/
+static size_t split_column(const char *str, size_t len, size_t *offsets) {
+    size_t n, off;
+
+    rng_state = 1;
+    n = 0;
+    off = 0;
+    offsets[0] = 0;
+    while (off < len) {
+        off += 8 + rnd(17);
+        while (off < len && (str[off] & 0xC0) == 0x80) {
+            off++;
+        }
+        offsets[++n] = (off < len) ? off : len;
+    }
+    return n;
+}
+
+static double now(void) {
+#if defined(_POSIX_TIMERS) && _POSIX_TIMERS > 0
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+enum {
+    FORMAT_TEXT, FORMAT_CSV, FORMAT_JSON
+};
+
+static void report(int format, int first, const char *corpus_name, size_t size, const char *name, size_t calls,
+                   double seconds, const counting_ctx *counts) {
+    double ns, gbps, allocs, bytes;
+
+    ns = seconds * 1e9 / (double) calls;
+    gbps = (double) size / ns;
+    allocs = (double) counts->allocs / (double) calls;
+    bytes = (double) counts->bytes / (double) calls;
+    switch (format) {
+        case FORMAT_CSV:
+            printf("%s,%lu,%s,%lu,%.1f,%.3f,%.1f,%.0f\n", corpus_name, (unsigned long) size, name,
+                   (unsigned long) calls, ns, gbps, allocs, bytes);
+            break;
+        case FORMAT_JSON:
+            printf("%s\n  {\"corpus\": \"%s\", \"size\": %lu, \"function\": \"%s\", \"calls\": %lu, "
+                   "\"ns_per_call\": %.1f, \"gb_per_s\": %.3f, \"allocs_per_call\": %.1f, \"alloc_bytes_per_call\": %.0f}",
+                   first ? "" : ",", corpus_name, (unsigned long) size, name, (unsigned long) calls, ns, gbps,
+                   allocs, bytes);
+            break;
+        default:
+            printf("%-9s %11lu  %-15s %14.1f ns %9.3f GB/s %12.1f allocs %14.0f bytes\n", corpus_name,
+                   (unsigned long) size, name, ns, gbps, allocs, bytes);
+            break;
+    }
+    fflush(stdout);
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: utf8c_bench [--format text|csv|json] [--max-size OCTETS] [--min-time SECONDS]"
+                    " [--filter NAME] [--isa scalar|sse2|ssse3|avx2|avx512]\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+    static const size_t sizes[] = {1024UL, 64UL * 1024, 1024UL * 1024, 16UL * 1024 * 1024, 256UL * 1024 * 1024,
+                                   1024UL * 1024 * 1024};
+    size_t max_size, si, ci, fi, calls, batch, k;
+    double min_time, start, elapsed;
+    const char *filter;
+    int format, first, i, isa;
+    char *text;
+    bench_ctx ctx;
+
+    format = FORMAT_TEXT;
+    max_size = UTF8C_BENCH_MAX_SIZE;
+    min_time = 0.2;
+    filter = NULL;
+    for (i = 1; i < argc; i++) {
+        if (i + 1 == argc) {
+            usage();
+        }
+        if (strcmp(argv[i], "--format") == 0) {
+            i++;
+            format = (strcmp(argv[i], "csv") == 0) ? FORMAT_CSV : (strcmp(argv[i], "json") == 0) ? FORMAT_JSON
+                                                                                                 : FORMAT_TEXT;
+        } else if (strcmp(argv[i], "--max-size") == 0) {
+            max_size = (size_t) strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--min-time") == 0) {
+            min_time = strtod(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--filter") == 0) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--isa") == 0) {
+            i++;
+            for (isa = UTF8_ISA_SCALAR; utf8_isa_name(isa) != NULL; isa++) {
+                if (strcmp(argv[i], utf8_isa_name(isa)) == 0) {
+                    break;
+                }
+            }
+            if (utf8_set_isa(isa) != UTF8_OK) {
+                fprintf(stderr, "unknown or unsupported instruction set %s\n", argv[i]);
+                exit(EXIT_FAILURE);
+            }
+        } else {
+            usage();
+        }
+    }
+
+    if (format == FORMAT_CSV) {
+        puts("corpus,size,function,calls,ns_per_call,gb_per_s,allocs_per_call,alloc_bytes_per_call");
+    } else if (format == FORMAT_JSON) {
+        printf("[");
+    }
+
+    ctx.alloc.alloc = counting_alloc;
+    ctx.alloc.resize = counting_resize;
+    ctx.alloc.release = counting_release;
+    ctx.alloc.ctx = &ctx.counts;
+
+    first = 1;
+    for (si = 0; si < sizeof(sizes) / sizeof(sizes[0]) && sizes[si] <= max_size; si++) {
+        text = malloc(sizes[si] + 1);
+        ctx.scratch = malloc(sizes[si] + 1);
+        ctx.units = malloc(sizes[si] * sizeof(utf8_char32));
+        ctx.utf16 = malloc(sizes[si] * sizeof(utf8_char16));
+        ctx.offsets = malloc((sizes[si] / 8 + 2) * sizeof(size_t));
+        if (text == NULL || ctx.scratch == NULL || ctx.units == NULL || ctx.utf16 == NULL || ctx.offsets == NULL) {
+            fprintf(stderr, "not enough memory for %lu octet corpora\n", (unsigned long) sizes[si]);
+            return EXIT_FAILURE;
+        }
+
+        for (ci = 0; ci < sizeof(corpora) / sizeof(corpora[0]); ci++) {
+            generate(text, sizes[si], &corpora[ci]);
+            ctx.str = text;
+            ctx.len = sizes[si];
+            ctx.n_cps = utf8_distance(text, text + sizes[si]);
+            ctx.utf16_len = utf8_to_utf16(text, sizes[si], ctx.utf16, sizes[si]);
+            memcpy(ctx.scratch, text, sizes[si] + 1);
+            ctx.n_strings = split_column(text, sizes[si], ctx.offsets);
+
+            for (fi = 0; fi < sizeof(cases) / sizeof(cases[0]); fi++) {
+                if ((filter != NULL && strstr(cases[fi].name, filter) == NULL)
+                    || (cases[fi].max_size != 0 && sizes[si] > cases[fi].max_size)) {
+                    continue;
+                }
+
+                /* Warm up caches and page in buffers, then run for at least `min_time`.
+                 * Batches grow, so that reading the clock doesn't show up in fast calls*/
+                cases[fi].run(&ctx);
+                ctx.counts.allocs = 0;
+                ctx.counts.bytes = 0;
+                calls = 0;
+                batch = 1;
+                start = now();
+                do {
+                    for (k = 0; k < batch; k++) {
+                        cases[fi].run(&ctx);
+                    }
+                    calls += batch;
+                    batch *= 2;
+                    elapsed = now() - start;
+                } while (elapsed < min_time);
+
+                report(format, first, corpora[ci].name, sizes[si], cases[fi].name, calls, elapsed, &ctx.counts);
+                first = 0;
+            }
+        }
+        free(text);
+        free(ctx.scratch);
+        free(ctx.units);
+        free(ctx.utf16);
+        free(ctx.offsets);
+    }
+
+    if (format == FORMAT_JSON) {
+        printf("\n]\n");
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,81 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Regression test: code point arrays of ill-formed input, elements are cut like utf8_view_next cuts them*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf8c.h>
+
+static int failures = 0;
+
+static void check(const char *name, const char *str, size_t len, size_t n_expected, const char *joined) {
+    char *copy, **arr, **flat;
+    size_t n_arr, n_flat, i, pos;
+
+    /* Exact-size copy, so reads past the input are caught by sanitizers*/
+    copy = malloc(len != 0 ? len : 1);
+    if (copy == NULL) {
+        failures++;
+        return;
+    }
+    memcpy(copy, str, len);
+
+    arr = utf8_to_arr_n(copy, len, &n_arr);
+    flat = utf8_to_arr_flat_n(copy, len, &n_flat);
+    if (arr == NULL || flat == NULL || n_arr != n_expected || n_flat != n_expected
+        || arr[n_arr] != NULL || flat[n_flat] != NULL) {
+        printf("FAIL %s: %lu and %lu elements, expected %lu\n", name, (unsigned long) n_arr,
+               (unsigned long) n_flat, (unsigned long) n_expected);
+        failures++;
+    } else {
+        for (i = 0, pos = 0; i < n_arr; pos += strlen(arr[i]), i++) {
+            if (strcmp(arr[i], flat[i]) != 0 || strncmp(arr[i], joined + pos, strlen(arr[i])) != 0) {
+                printf("FAIL %s: element %lu differs\n", name, (unsigned long) i);
+                failures++;
+                break;
+            }
+        }
+        if (pos != strlen(joined)) {
+            printf("FAIL %s: elements hold %lu octets, expected %lu\n", name, (unsigned long) pos,
+                   (unsigned long) strlen(joined));
+            failures++;
+        }
+    }
+    utf8_arr_free(arr);
+    free(flat);
+    free(copy);
+}
+
+int main(void) {
+    check("valid", "\xd0\xb0" "abc\xe3\x85\x8a", 8, 5, "\xd0\xb0" "abc\xe3\x85\x8a");
+    check("truncated in the middle", "\xe3\x81" "abcd", 6, 5, "\xe3\x81" "abcd");
+    check("truncated lead before ascii", "\xc3" "a", 2, 2, "\xc3" "a");
+    check("truncated at the end", "ab\xe3\x81", 4, 3, "ab\xe3\x81");
+    check("leading continuation octets", "\x80\x80" "ab", 4, 2, "ab");
+    check("continuation octets only", "\x80\xbf", 2, 0, "");
+    check("empty", "", 0, 0, "");
+    check("over-long continuation run", "\xf0\x90\x80\x80\x80" "a", 6, 2, "\xf0\x90\x80\x80\x80" "a");
+    return failures != 0;
+}
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""Generates utf8c/utf8c_grapheme_tables.h from the Unicode Character Database.
+
+Usage: gen_grapheme_tables.py UCD_DIR > utf8c/utf8c_grapheme_tables.h
+
+UCD_DIR must contain GraphemeBreakProperty.txt (ucd/auxiliary) and emoji-data.txt (ucd/emoji)
+of the same Unicode version. The output is a two-stage table: code point >> SHIFT selects a block
+in stage 1, the block in stage 2 holds the property of every code point in it. Identical blocks are stored once.
+"""
+import os
+import re
+import sys
+
+SHIFT = 7
+MAX_CP = 0x110000
+
+# Order defines the numeric values used by utf8c_grapheme.c
+PROPS = ["Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator", "Prepend", "SpacingMark",
+         "L", "V", "T", "LV", "LVT", "Extended_Pictographic"]
+
+
+def parse(path, wanted=None):
+    """Yields (first, last, value) for every data line, along with the file name from the header"""
+    version = None
+    ranges = []
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            if version is None:
+                m = re.match(r"#\s*(\S+\.txt)", line)
+                if m:
+                    version = m.group(1)
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            cps, value = [field.strip() for field in line.split(";")[:2]]
+            if wanted is not None and value != wanted:
+                continue
+            first, _, last = cps.partition("..")
+            ranges.append((int(first, 16), int(last or first, 16), value))
+    return version or os.path.basename(path), ranges
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+    ucd = sys.argv[1]
+
+    gcb_name, gcb = parse(os.path.join(ucd, "GraphemeBreakProperty.txt"))
+    emoji_name, emoji = parse(os.path.join(ucd, "emoji-data.txt"), "Extended_Pictographic")
+
+    props = [0] * MAX_CP
+    for first, last, value in gcb:
+        for cp in range(first, last + 1):
+            props[cp] = PROPS.index(value)
+    # Extended_Pictographic code points are all Grapheme_Cluster_Break=Other, so they get a value of their own
+    for first, last, _ in emoji:
+        for cp in range(first, last + 1):
+            if props[cp] != 0:
+                sys.exit("U+%04X is both Extended_Pictographic and %s" % (cp, PROPS[props[cp]]))
+            props[cp] = PROPS.index("Extended_Pictographic")
+
+    block_size = 1 << SHIFT
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, MAX_CP, block_size):
+        block = tuple(props[start:start + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    stage1_type = "unsigned char" if len(blocks) <= 256 else "unsigned short"
+
+    out = sys.stdout
+    out.write("/* Generated by tools/gen_grapheme_tables.py from %s and %s. Do not edit*/\n" % (gcb_name, emoji_name))
+    out.write("#ifndef UTF8C_GRAPHEME_TABLES_H\n#define UTF8C_GRAPHEME_TABLES_H\n\n")
+    out.write("/* Grapheme_Cluster_Break property values, Extended_Pictographic is folded in as one more*/\n")
+    for i, name in enumerate(PROPS):
+        out.write("#define UTF8C_GB_%s %d\n" % (name.upper(), i))
+    out.write("\n/* Property of `cp` is utf8c_gb_stage2[(utf8c_gb_stage1[cp >> UTF8C_GB_SHIFT] << UTF8C_GB_SHIFT)"
+              " + (cp & UTF8C_GB_MASK)]*/\n")
+    out.write("#define UTF8C_GB_SHIFT %d\n#define UTF8C_GB_MASK 0x%X\n\n" % (SHIFT, block_size - 1))
+
+    for name, ctype, table in (("utf8c_gb_stage1", stage1_type, stage1),
+                               ("utf8c_gb_stage2", "unsigned char", stage2)):
+        out.write("static const %s %s[%d] = {\n" % (ctype, name, len(table)))
+        for i in range(0, len(table), 24):
+            out.write("        " + ", ".join(str(v) for v in table[i:i + 24]) + ",\n")
+        out.write("};\n\n")
+    out.write("#endif /* UTF8C_GRAPHEME_TABLES_H*/\n")
+
+
+if __name__ == "__main__":
+    main()
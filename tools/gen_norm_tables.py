@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Generates utf8c/utf8c_norm_tables.h from the Unicode Character Database.
+
+Usage: gen_norm_tables.py UCD_DIR > utf8c/utf8c_norm_tables.h
+
+UCD_DIR must contain UnicodeData.txt, CompositionExclusions.txt and CaseFolding.txt of the same Unicode version.
+Every code point gets a record with its canonical combining class, quick check flags and offsets of its full
+canonical decomposition and full case folding in a shared array of code points. Records are looked up through
+a two-stage table like the one of gen_grapheme_tables.py. Hangul syllables are left to the algorithm of
+chapter 3.12 of the standard, only their quick check flags are stored.
+"""
+import os
+import re
+import sys
+
+SHIFT = 6
+MAX_CP = 0x110000
+
+# Hangul syllables, chapter 3.12
+S_BASE, L_BASE, V_BASE, T_BASE = 0xAC00, 0x1100, 0x1161, 0x11A7
+L_COUNT, V_COUNT, T_COUNT = 19, 21, 28
+S_COUNT = L_COUNT * V_COUNT * T_COUNT
+
+# Flags above the combining class, must match utf8c_normalize.c
+NFD_NO = 0x100
+NFC_NO = 0x200
+NFC_MAYBE = 0x400
+FOLDS = 0x800
+
+
+def header_name(path):
+    """Returns the versioned file name from the first comment line, if there's one"""
+    with open(path, encoding="utf-8") as f:
+        m = re.match(r"#\s*(\S+\.txt)", f.readline())
+    return m.group(1) if m else os.path.basename(path)
+
+
+def data_lines(path):
+    """Yields the fields of every data line"""
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if line:
+                yield [field.strip() for field in line.split(";")]
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+    ucd = sys.argv[1]
+
+    ccc = [0] * MAX_CP
+    decomp = {}
+    for fields in data_lines(os.path.join(ucd, "UnicodeData.txt")):
+        cp = int(fields[0], 16)
+        ccc[cp] = int(fields[3])
+        if fields[5] and not fields[5].startswith("<"):  # Compatibility decompositions aren't used
+            decomp[cp] = [int(x, 16) for x in fields[5].split()]
+
+    excluded = set(int(fields[0], 16) for fields in data_lines(os.path.join(ucd, "CompositionExclusions.txt")))
+
+    folding = {}
+    for fields in data_lines(os.path.join(ucd, "CaseFolding.txt")):
+        if fields[1] in ("C", "F"):  # Full case folding, S and T are the alternatives
+            folding[int(fields[0], 16)] = [int(x, 16) for x in fields[2].split()]
+
+    def full_decomp(cp):
+        if cp not in decomp:
+            return [cp]
+        return [d for part in decomp[cp] for d in full_decomp(part)]
+
+    # Full_Composition_Exclusion adds singletons and non-starter decompositions to the listed exclusions
+    compose = {}
+    flags = [0] * MAX_CP
+    for cp, parts in decomp.items():
+        flags[cp] |= NFD_NO
+        if cp in excluded or len(parts) == 1 or ccc[cp] != 0 or ccc[parts[0]] != 0:
+            flags[cp] |= NFC_NO
+        else:
+            compose[(parts[0], parts[1])] = cp
+            flags[parts[1]] |= NFC_MAYBE
+    for cp in range(S_BASE, S_BASE + S_COUNT):
+        flags[cp] |= NFD_NO
+    for cp in list(range(V_BASE, V_BASE + V_COUNT)) + list(range(T_BASE + 1, T_BASE + T_COUNT)):
+        flags[cp] |= NFC_MAYBE
+    for cp in folding:
+        flags[cp] |= FOLDS
+
+    # Sequences are stored as their length followed by the code points, offset 0 is the empty one
+    data = [0]
+    sequences = {}
+
+    def store(seq):
+        key = tuple(seq)
+        if key not in sequences:
+            sequences[key] = len(data)
+            data.append(len(seq))
+            data.extend(seq)
+        return sequences[key]
+
+    records = {(0, 0, 0): 0}
+    props = [0] * MAX_CP
+    for cp in range(MAX_CP):
+        if ccc[cp] == 0 and flags[cp] == 0:
+            continue
+        record = (ccc[cp] | flags[cp],
+                  store(full_decomp(cp)) if cp in decomp else 0,
+                  store(folding[cp]) if cp in folding else 0)
+        if record not in records:
+            records[record] = len(records)
+        props[cp] = records[record]
+    if len(records) > 0x10000 or len(data) > 0x10000:
+        sys.exit("Tables outgrew 16-bit indices")
+
+    block_size = 1 << SHIFT
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, MAX_CP, block_size):
+        block = tuple(props[start:start + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    stage1_type = "unsigned char" if len(blocks) <= 256 else "unsigned short"
+
+    out = sys.stdout
+
+    def write_table(name, ctype, table, per_line=16):
+        out.write("static const %s %s[%d] = {\n" % (ctype, name, len(table)))
+        for i in range(0, len(table), per_line):
+            out.write("        " + ", ".join(str(v) for v in table[i:i + per_line]) + ",\n")
+        out.write("};\n\n")
+
+    out.write("/* Generated by tools/gen_norm_tables.py from UnicodeData.txt, %s and %s. Do not edit*/\n"
+              % (header_name(os.path.join(ucd, "CompositionExclusions.txt")),
+                 header_name(os.path.join(ucd, "CaseFolding.txt"))))
+    out.write("#ifndef UTF8C_NORM_TABLES_H\n#define UTF8C_NORM_TABLES_H\n\n")
+    out.write("/* Record of `cp` is utf8c_norm_records[utf8c_norm_stage2[(utf8c_norm_stage1[cp >> UTF8C_NORM_SHIFT]"
+              " << UTF8C_NORM_SHIFT)\n * + (cp & UTF8C_NORM_MASK)]]*/\n")
+    out.write("#define UTF8C_NORM_SHIFT %d\n#define UTF8C_NORM_MASK 0x%X\n\n" % (SHIFT, block_size - 1))
+    write_table("utf8c_norm_stage1", stage1_type, stage1, 24)
+    write_table("utf8c_norm_stage2", "unsigned short", stage2)
+
+    out.write("/* Canonical combining class and flags, offset of the full canonical decomposition in utf8c_norm_data\n"
+              " * and offset of the full case folding in it. Offset 0 means there's none*/\n")
+    out.write("static const unsigned short utf8c_norm_records[%d][3] = {\n" % len(records))
+    ordered = sorted(records, key=records.get)
+    for i in range(0, len(ordered), 6):
+        out.write("        " + ", ".join("{%d, %d, %d}" % r for r in ordered[i:i + 6]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("/* Sequences of code points, each one is preceded by its length*/\n")
+    write_table("utf8c_norm_data", "utf8_char32", data)
+
+    out.write("/* Primary composites, sorted by the first and then by the second code point of their decomposition*/\n")
+    out.write("static const utf8_char32 utf8c_norm_compose[%d][3] = {\n" % len(compose))
+    pairs = sorted(compose)
+    for i in range(0, len(pairs), 4):
+        out.write("        " + ", ".join("{%d, %d, %d}" % (a, b, compose[(a, b)]) for a, b in pairs[i:i + 4]) + ",\n")
+    out.write("};\n\n")
+    out.write("#endif /* UTF8C_NORM_TABLES_H*/\n")
+
+
+if __name__ == "__main__":
+    main()
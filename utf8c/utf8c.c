@@ -26,10 +26,20 @@ SOFTWARE.
 #include <stdarg.h>
 #include <errno.h>
 #include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_alloc.h"
+#include "utf8c_stats.h"
+
+/* Number of string lengths variadic functions remember between their two passes over arguments*/
+#define UTF8C_VSTRCAT_CACHE 16
+
+/* utf8_repeat doubles short strings up to this many octets, then copies the block over and over*/
+#define UTF8C_REPEAT_BLOCK 8192
 
 const size_t utf8_npos = (size_t) -1;
 
 char *utf8_next(const char *begin, const char *end) {
+    UTF8C_STAT_CALL(utf8_next, 0);
     if (begin == end) {
         return NULL;
     }
@@ -44,10 +54,12 @@ char *utf8_next(const char *begin, const char *end) {
         begin += 4;
     }
 
+    UTF8C_STAT_ADD(cps, 1);
     return (char *) begin;
 }
 
 char *utf8_prior(const char *begin, const char *end) {
+    UTF8C_STAT_CALL(utf8_prior, 0);
 
     if (begin == end) {
         return NULL;
@@ -57,145 +69,209 @@ char *utf8_prior(const char *begin, const char *end) {
         begin--;
     } while ((*begin & 0xC0) == 0x80);
 
+    UTF8C_STAT_ADD(cps, 1);
     return (char *) begin;
 }
 
 char *utf8_advance(const char *begin, size_t n, const char *end) {
-    size_t i;
-    char *(*iter_function)(const char *, const char *);
-
-    iter_function = (begin < end)
-                    ? utf8_next
-                    : utf8_prior;
+    UTF8C_STAT_CALL(utf8_advance, UTF8C_STAT_SPAN(begin, end));
+    if (begin < end) {
+        /* Skip whole blocks while they have less code points than left, then finish octet by octet.
+         * After skipping, `begin` might point in the middle of a code point*/
+        begin += utf8c_skip_forward(begin, (size_t) (end - begin), &n);
+        for (; begin != end; begin++) {
+            if (UTF8C_IS_LEAD(*begin)) {
+                if (n == 0) {
+                    return (char *) begin;
+                }
+                n--;
+            }
+        }
+        return (n == 0) ? (char *) end : NULL;
+    }
 
-    for (i = 0; i < n; i++) {
-        begin = iter_function(begin, end);
-        if (begin == NULL) { /* Can't advance string as n is bigger than number of code points available*/
+    begin -= utf8c_skip_backward(end, (size_t) (begin - end), &n);
+    while (n > 0) {
+        if (begin == end) { /* Can't advance string as n is bigger than number of code points available*/
             return NULL;
         }
+        begin--;
+        if (UTF8C_IS_LEAD(*begin)) {
+            n--;
+        }
     }
     return (char *) begin;
 }
 
+int utf8_validate(const char *begin, const char *end, size_t *error_offset) {
+    size_t len, off;
+
+    UTF8C_STAT_CALL(utf8_validate, UTF8C_STAT_SPAN(begin, end));
+    if (begin == NULL || end == NULL || end < begin) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    len = (size_t) (end - begin);
+    off = utf8c_validate(begin, len);
+    if (off != len) {
+        if (error_offset != NULL) {
+            *error_offset = off;
+        }
+        errno = UTF8_EILSEQ;
+        return UTF8_EILSEQ;
+    }
+    return UTF8_OK;
+}
 
 char *utf8_repeat(const char *str, size_t n) {
-    size_t len, i;
-    char *new_str, *begin;
+    UTF8C_STAT_CALL(utf8_repeat, 0);
+    return utf8_repeat_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, n, NULL);
+}
+
+char *utf8_repeat_n(const char *str, size_t len, size_t n, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_repeat_n, len);
+    return utf8_repeat_a(NULL, str, len, n, out_len);
+}
+
+char *utf8_repeat_a(const utf8_allocator *alloc, const char *str, size_t len, size_t n, size_t *out_len) {
+    size_t total, block, copied, chunk;
+    char *new_str;
 
+    UTF8C_STAT_CALL(utf8_repeat_a, len);
     if (str == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    len = strlen(str);
-    new_str = (char *) malloc(sizeof(char) * (len * n + 1));
+    if (n != 0 && len > ((size_t) -1 - 1) / n) {
+        errno = UTF8_ERANGE;
+        return NULL;
+    }
+
+    total = len * n;
+    new_str = (char *) utf8c_alloc(alloc, sizeof(char) * (total + 1));
     if (new_str == NULL) {
         errno = UTF8_ENOMEM;
         return NULL;
     }
 
-    begin = new_str;
-    for (i = 0; i < n; i++) {
+    /* Short strings are doubled into a block of whole copies first, so that there are few big memcpys.
+     * The block stops growing while it still fits into the cache*/
+    block = 0;
+    if (total != 0) {
         memcpy(new_str, str, sizeof(char) * len);
-        new_str += len;
+        for (block = len; block < UTF8C_REPEAT_BLOCK && block < total; block += chunk) {
+            chunk = (block < total - block) ? block : total - block;
+            memcpy(new_str + block, new_str, sizeof(char) * chunk);
+        }
     }
-    *new_str = '\0';
-    return begin;
+    for (copied = block; copied < total; copied += chunk) {
+        chunk = (block < total - copied) ? block : total - copied;
+        memcpy(new_str + copied, new_str, sizeof(char) * chunk);
+    }
+    new_str[total] = '\0';
+    if (out_len != NULL) {
+        *out_len = total;
+    }
+    return new_str;
 }
 
 size_t utf8_distance(const char *begin, const char *end) {
-    size_t dist;
-    char *(*iter_function)(const char *, const char *);
-
-    dist = 0;
-
-    iter_function = (begin < end)
-                    ? utf8_next
-                    : utf8_prior;
-
-    while ((begin = iter_function(begin, end))) {
-        dist++;
-    }
-
-    return dist;
+    size_t n;
+
+    UTF8C_STAT_CALL(utf8_distance, UTF8C_STAT_SPAN(begin, end));
+    /* Every code point starts with exactly one non-continuation octet, so counting them
+     * gives the same result as stepping with utf8_next/utf8_prior, but in bulk*/
+    n = (begin < end)
+        ? utf8c_count_leads(begin, (size_t) (end - begin))
+        : utf8c_count_leads(end, (size_t) (begin - end));
+    UTF8C_STAT_ADD(cps, n);
+    return n;
 }
 
 char *utf8_reverse(char str[]) {
-    size_t len;
-    char tmp, *src, *dst, *begin, *end, *it;
+    UTF8C_STAT_CALL(utf8_reverse, 0);
+    return utf8_reverse_n(str, (str != NULL) ? utf8c_strlen(str) : 0);
+}
 
+char *utf8_reverse_n(char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_reverse_n, len);
     if (str == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    len = strlen(str);
-
-    if (len <= 1) { /* Can't do much to 1 character string, leave it unchanged*/
-        return str;
-    }
+    /* Reverses all octets at once, then puts octets of every multi-octet code point back in order*/
+    utf8c_reverse(str, len);
+    return str;
+}
 
-    begin = &str[0];
-    end = &str[len];
-    it = begin;
-
-    /* Iterate through the string and reverse the order of utf-8 grapheme's
-     * multibyte octets, so we can restore them in the next iteration*/
-    while ((it = utf8_next(it, end))) {
-        if (it - str > 1) { /* Only proceed if code point is multi-byte*/
-            src = str;
-            dst = it - 1; /* Point to the last octet of current grapheme instead of first octet of next grapheme*/
-            while (src < dst) {
-                tmp = *src;
-                *src++ = *dst;
-                *dst-- = tmp;
-            }
-        }
-        str = it;
+char *utf8_reverse_to(const char *str, size_t len, char *dst) {
+    UTF8C_STAT_CALL(utf8_reverse_to, len);
+    if (str == NULL || dst == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
     }
 
-    /* Iterate through whole string octet-by-octet and reverse it.
-     * This will reverse early reversed utf-8 graphemes back to the valid state*/
-    src = begin;
-    dst = end - 1; /* Skip null character*/
-    while (src < dst) {
-        tmp = *src;
-        *src++ = *dst;
-        *dst-- = tmp;
-    }
-    return begin;
+    /* Every code point is copied straight to its final place in a single pass*/
+    utf8c_reverse_copy(str, len, dst);
+    dst[len] = '\0';
+    return dst;
 }
 
 char *utf8_strcpy(const char *str) {
-    size_t len;
+    UTF8C_STAT_CALL(utf8_strcpy, 0);
+    return utf8_strcpy_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, NULL);
+}
+
+char *utf8_strcpy_n(const char *str, size_t len, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_strcpy_n, len);
+    return utf8_strcpy_a(NULL, str, len, out_len);
+}
+
+char *utf8_strcpy_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len) {
     char *new_str;
 
+    UTF8C_STAT_CALL(utf8_strcpy_a, len);
     if (str == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    len = strlen(str);
-    new_str = (char *) malloc(sizeof(char) * (len + 1));
+    new_str = (char *) utf8c_alloc(alloc, sizeof(char) * (len + 1));
     if (new_str == NULL) {
         errno = UTF8_ENOMEM;
         return NULL;
     }
-    memcpy(new_str, str, sizeof(char) * (len + 1));
+    memcpy(new_str, str, sizeof(char) * len);
+    new_str[len] = '\0';
+    if (out_len != NULL) {
+        *out_len = len;
+    }
     return new_str;
 }
 
 char *utf8_substr(const char *str, size_t off, size_t count) {
-    size_t len, new_len;
+    UTF8C_STAT_CALL(utf8_substr, 0);
+    return utf8_substr_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, off, count, NULL);
+}
+
+char *utf8_substr_n(const char *str, size_t len, size_t off, size_t count, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_substr_n, len);
+    return utf8_substr_a(NULL, str, len, off, count, out_len);
+}
+
+char *utf8_substr_a(const utf8_allocator *alloc, const char *str, size_t len, size_t off, size_t count,
+                    size_t *out_len) {
     const char *begin, *end, *it_begin, *it_end;
-    char *new_str;
 
+    UTF8C_STAT_CALL(utf8_substr_a, len);
     if (str == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    len = strlen(str);
     begin = &str[0];
     end = &str[len];
 
@@ -214,80 +290,105 @@ char *utf8_substr(const char *str, size_t off, size_t count) {
         it_end = end; /* Count goes beyond last string code point, use `end` as last valid code point position*/
     }
 
-    new_len = it_end - it_begin; /* Number of octets(bytes) between begin position and end position*/
+    /* Number of octets(bytes) between begin position and end position*/
+    return utf8_strcpy_a(alloc, it_begin, (size_t) (it_end - it_begin), out_len);
+}
 
-    new_str = malloc(sizeof(char) * (new_len + 1));
-    if (new_str == NULL) {
-        errno = UTF8_ENOMEM;
-        return NULL;
-    }
 
-    memcpy(new_str, it_begin, sizeof(char) * new_len);
-    new_str[new_len] = '\0';
-    return new_str;
+char *utf8_join(const char *str, const char *joiner) {
+    UTF8C_STAT_CALL(utf8_join, 0);
+    return utf8_join_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, joiner, (joiner != NULL) ? utf8c_strlen(joiner) : 0,
+                       NULL);
 }
 
+char *utf8_join_n(const char *str, size_t len, const char *joiner, size_t joiner_len, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_join_n, len);
+    return utf8_join_a(NULL, str, len, joiner, joiner_len, out_len);
+}
 
-char *utf8_join(const char *str, const char *joiner) {
-    char *new_str, *new_begin;
-    const char *begin, *end, *it;
-    size_t len, dist, joiner_len, n_octets;
+char *utf8_join_a(const utf8_allocator *alloc, const char *str, size_t len, const char *joiner, size_t joiner_len,
+                  size_t *out_len) {
+    char *new_str, *shrunk;
+    size_t n_joiners, cap, n_octets;
 
+    UTF8C_STAT_CALL(utf8_join_a, len);
     if (str == NULL || joiner == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    len = strlen(str);
     if (len < 2) { /* Can't do much to palindrome-ish string, return unchanged copy*/
-        return utf8_strcpy(str);
+        return utf8_strcpy_a(alloc, str, len, out_len);
     }
 
-    joiner_len = strlen(joiner);
     if (joiner_len == 0) { /* Can't do much with empty joiner, return unchanged copy*/
-        return utf8_strcpy(str);
+        return utf8_strcpy_a(alloc, str, len, out_len);
     }
 
-    begin = &str[0];
-    end = &str[len];
-
-    dist = utf8_distance(begin, end);
-
-    new_str = (char *) malloc(sizeof(char) * (joiner_len * (dist - 1) + len + 1));
+    /* Any octet but the first may start a code point. Sized for that, the result is written in a single pass
+     * and the unused tail is given back. Code points are only counted if that bound can't be allocated*/
+    new_str = NULL;
+    cap = 0;
+    if (joiner_len <= ((size_t) -1 - 1 - len) / (len - 1)) {
+        cap = len + joiner_len * (len - 1);
+        new_str = (char *) utf8c_alloc(alloc, sizeof(char) * (cap + 1));
+    }
     if (new_str == NULL) {
-        errno = UTF8_ENOMEM;
-        return NULL;
+        n_joiners = utf8_distance(str, &str[len]) - UTF8C_IS_LEAD(str[0]);
+        UTF8C_STAT_RESUME(utf8_join_a);
+        if (n_joiners != 0 && joiner_len > ((size_t) -1 - 1 - len) / n_joiners) {
+            errno = UTF8_ERANGE;
+            return NULL;
+        }
+        cap = len + joiner_len * n_joiners;
+        new_str = (char *) utf8c_alloc(alloc, sizeof(char) * (cap + 1));
+        if (new_str == NULL) {
+            errno = UTF8_ENOMEM;
+            return NULL;
+        }
     }
 
-    new_begin = new_str;
-    it = begin;
-    while ((it = utf8_next(it, end))) {
-        n_octets = it - str;
-        memcpy(new_str, str, sizeof(char) * n_octets);
-        new_str += n_octets;
-        if (it == end) break;
-        memcpy(new_str, joiner, sizeof(char) * joiner_len);
-        new_str += joiner_len;
-        str = it;
+    n_octets = utf8c_join(str, len, joiner, joiner_len, new_str);
+    new_str[n_octets] = '\0';
+    if (n_octets < cap) {
+        shrunk = (char *) utf8c_realloc(alloc, new_str, sizeof(char) * (cap + 1), sizeof(char) * (n_octets + 1));
+        if (shrunk != NULL) { /* Otherwise the bigger buffer is just as good*/
+            new_str = shrunk;
+        }
     }
 
-    *new_str = '\0';
-    return new_begin;
+    if (out_len != NULL) {
+        *out_len = n_octets;
+    }
+    return new_str;
 }
 
 char *utf8_strcat(const char *a, const char *b) {
-    size_t len_a, len_b;
+    UTF8C_STAT_CALL(utf8_strcat, 0);
+    return utf8_strcat_a(NULL, a, (a != NULL) ? utf8c_strlen(a) : 0, b, (b != NULL) ? utf8c_strlen(b) : 0, NULL);
+}
+
+char *utf8_strcat_n(const char *a, size_t len_a, const char *b, size_t len_b, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_strcat_n, len_a + len_b);
+    return utf8_strcat_a(NULL, a, len_a, b, len_b, out_len);
+}
+
+char *utf8_strcat_a(const utf8_allocator *alloc, const char *a, size_t len_a, const char *b, size_t len_b,
+                    size_t *out_len) {
     char *new_str;
 
+    UTF8C_STAT_CALL(utf8_strcat_a, len_a + len_b);
     if (a == NULL || b == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    len_a = strlen(a);
-    len_b = strlen(b);
+    if (len_a > (size_t) -1 - 1 || len_b > (size_t) -1 - 1 - len_a) {
+        errno = UTF8_ERANGE;
+        return NULL;
+    }
 
-    new_str = (char *) malloc(sizeof(char) * (len_a + len_b + 1));
+    new_str = (char *) utf8c_alloc(alloc, sizeof(char) * (len_a + len_b + 1));
     if (new_str == NULL) {
         errno = UTF8_ENOMEM;
         return NULL;
@@ -296,39 +397,61 @@ char *utf8_strcat(const char *a, const char *b) {
     memcpy(new_str, a, sizeof(char) * len_a);
     memcpy(new_str + len_a, b, sizeof(char) * len_b);
     new_str[len_a + len_b] = '\0';
+    if (out_len != NULL) {
+        *out_len = len_a + len_b;
+    }
     return new_str;
 }
 
 char *utf8_mvstrcat(char *a, char *b) {
-    size_t len_a, len_b;
+    UTF8C_STAT_CALL(utf8_mvstrcat, 0);
+    if (a == NULL || b == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    return utf8_mvstrcat_a(NULL, a, utf8c_strlen(a), b, utf8c_strlen(b), NULL);
+}
+
+char *utf8_mvstrcat_a(const utf8_allocator *alloc, char *a, size_t len_a, char *b, size_t len_b, size_t *out_len) {
     char *new_str;
 
+    UTF8C_STAT_CALL(utf8_mvstrcat_a, len_a + len_b);
     if (a == NULL || b == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    len_a = strlen(a);
-    len_b = strlen(b);
-    new_str = (char *) realloc(a, sizeof(char) * (len_a + len_b + 1));
+    if (len_a > (size_t) -1 - 1 || len_b > (size_t) -1 - 1 - len_a) { /* Freed like on allocation failure*/
+        utf8c_free(alloc, a);
+        utf8c_free(alloc, b);
+        errno = UTF8_ERANGE;
+        return NULL;
+    }
+
+    new_str = (char *) utf8c_realloc(alloc, a, sizeof(char) * (len_a + 1), sizeof(char) * (len_a + len_b + 1));
     if (new_str == NULL) {
-        free(a);
-        free(b);
+        utf8c_free(alloc, a);
+        utf8c_free(alloc, b);
         errno = UTF8_ENOMEM;
         return NULL;
     }
 
     memcpy(new_str + len_a, b, sizeof(char) * len_b);
     new_str[len_a + len_b] = '\0';
-    free(b);
+    utf8c_free(alloc, b);
+    if (out_len != NULL) {
+        *out_len = len_a + len_b;
+    }
     return new_str;
 }
 
 char *utf8_vstrcat(size_t n_str, ...) {
-    size_t len, i, temp_len;
+    size_t len, i, temp_len, lens[UTF8C_VSTRCAT_CACHE];
     char *str, *new_str, *new_begin;
     va_list args;
 
+    UTF8C_STAT_CALL(utf8_vstrcat, 0);
     if (n_str < 1) {
         return NULL;
     }
@@ -337,14 +460,19 @@ char *utf8_vstrcat(size_t n_str, ...) {
     for (i = 0, len = 0; i < n_str; i++) {
         str = va_arg(args, char *);
         if (str == NULL) {
+            va_end(args);
             errno = UTF8_EINVAL;
             return NULL;
         }
-        len += strlen(str);
+        temp_len = utf8c_strlen(str);
+        if (i < UTF8C_VSTRCAT_CACHE) {
+            lens[i] = temp_len;
+        }
+        len += temp_len;
     }
     va_end(args);
 
-    new_str = (char *) malloc(sizeof(char) * (len + 1));
+    new_str = (char *) utf8c_alloc(NULL, sizeof(char) * (len + 1));
     if (new_str == NULL) {
         errno = UTF8_ENOMEM;
         return NULL;
@@ -354,7 +482,7 @@ char *utf8_vstrcat(size_t n_str, ...) {
     va_start(args, n_str);
     for (i = 0; i < n_str; i++) {
         str = va_arg(args, char *);
-        temp_len = strlen(str);
+        temp_len = (i < UTF8C_VSTRCAT_CACHE) ? lens[i] : utf8c_strlen(str);
         memcpy(new_str, str, sizeof(char) * temp_len);
         new_str += temp_len;
     }
@@ -364,11 +492,84 @@ char *utf8_vstrcat(size_t n_str, ...) {
     return new_begin;
 }
 
-char *utf8_vmvstrcat(size_t n_strings, ...) {
+/* Two passes over (string, length) pairs, `sizing` and `copying` must both point to the first pair*/
+static char *vstrcat_pairs(const utf8_allocator *alloc, size_t n_str, size_t *out_len,
+                           va_list sizing, va_list copying) {
     size_t len, i, temp_len;
+    const char *str;
+    char *new_str, *new_begin;
+
+    if (n_str < 1) {
+        return NULL;
+    }
+
+    for (i = 0, len = 0; i < n_str; i++) {
+        str = va_arg(sizing, const char *);
+        temp_len = va_arg(sizing, size_t);
+        if (str == NULL) {
+            errno = UTF8_EINVAL;
+            return NULL;
+        }
+        if (temp_len > (size_t) -1 - 1 - len) {
+            errno = UTF8_ERANGE;
+            return NULL;
+        }
+        len += temp_len;
+    }
+
+    new_str = (char *) utf8c_alloc(alloc, sizeof(char) * (len + 1));
+    if (new_str == NULL) {
+        errno = UTF8_ENOMEM;
+        return NULL;
+    }
+
+    new_begin = new_str;
+    for (i = 0; i < n_str; i++) {
+        str = va_arg(copying, const char *);
+        temp_len = va_arg(copying, size_t);
+        memcpy(new_str, str, sizeof(char) * temp_len);
+        new_str += temp_len;
+    }
+
+    *new_str = '\0';
+    if (out_len != NULL) {
+        *out_len = len;
+    }
+    return new_begin;
+}
+
+char *utf8_vstrcat_n(size_t n_str, size_t *out_len, ...) {
+    char *new_str;
+    va_list sizing, copying;
+
+    UTF8C_STAT_CALL(utf8_vstrcat_n, 0);
+    va_start(sizing, out_len);
+    va_start(copying, out_len);
+    new_str = vstrcat_pairs(NULL, n_str, out_len, sizing, copying);
+    va_end(copying);
+    va_end(sizing);
+    return new_str;
+}
+
+char *utf8_vstrcat_a(const utf8_allocator *alloc, size_t n_str, size_t *out_len, ...) {
+    char *new_str;
+    va_list sizing, copying;
+
+    UTF8C_STAT_CALL(utf8_vstrcat_a, 0);
+    va_start(sizing, out_len);
+    va_start(copying, out_len);
+    new_str = vstrcat_pairs(alloc, n_str, out_len, sizing, copying);
+    va_end(copying);
+    va_end(sizing);
+    return new_str;
+}
+
+char *utf8_vmvstrcat(size_t n_strings, ...) {
+    size_t len, first_len, i, temp_len, lens[UTF8C_VSTRCAT_CACHE];
     char *str, *new_str, *new_begin;
     va_list args;
 
+    UTF8C_STAT_CALL(utf8_vmvstrcat, 0);
     if (n_strings < 1) {
         return NULL;
     }
@@ -381,13 +582,18 @@ char *utf8_vmvstrcat(size_t n_strings, ...) {
             errno = UTF8_EINVAL;
             goto fail;
         }
-        len += strlen(str);
+        temp_len = utf8c_strlen(str);
+        if (i < UTF8C_VSTRCAT_CACHE) {
+            lens[i] = temp_len;
+        }
+        len += temp_len;
     }
     va_end(args);
 
     va_start(args, n_strings);
     str = va_arg(args, char *);
-    new_str = (char *) realloc(str, sizeof(char) * (len + 1));
+    first_len = lens[0];
+    new_str = (char *) utf8c_realloc(NULL, str, sizeof(char) * (first_len + 1), sizeof(char) * (len + 1));
     if (new_str == NULL) {
         va_end(args);
         errno = UTF8_ENOMEM;
@@ -395,14 +601,14 @@ char *utf8_vmvstrcat(size_t n_strings, ...) {
     }
 
     new_begin = new_str;
-    new_str += strlen(new_str);
+    new_str += first_len;
 
     for (i = 1; i < n_strings; i++) {
         str = va_arg(args, char *);
-        temp_len = strlen(str);
+        temp_len = (i < UTF8C_VSTRCAT_CACHE) ? lens[i] : utf8c_strlen(str);
         memcpy(new_str, str, sizeof(char) * temp_len);
         new_str += temp_len;
-        free(str);
+        utf8c_free(NULL, str);
     }
     va_end(args);
     *new_str = '\0';
@@ -412,39 +618,133 @@ char *utf8_vmvstrcat(size_t n_strings, ...) {
     va_start(args, n_strings);
     for (i = 0; i < n_strings; i++) {
         str = va_arg(args, char *);
-        free(str);
+        utf8c_free(NULL, str);
     }
     va_end(args);
     return NULL;
 
 }
 
+/* Two passes over (string, length) pairs, `sizing` and `moving` must both point to the first pair*/
+static char *vmvstrcat_pairs(const utf8_allocator *alloc, size_t n_strings, size_t *out_len,
+                             va_list sizing, va_list moving) {
+    size_t len, first_len, i, temp_len;
+    char *str, *new_str, *new_begin;
+
+    if (n_strings < 1) {
+        return NULL;
+    }
+
+    for (i = 0, len = 0; i < n_strings; i++) {
+        str = va_arg(sizing, char *);
+        temp_len = va_arg(sizing, size_t);
+        if (str == NULL) {
+            errno = UTF8_EINVAL;
+            goto fail;
+        }
+        if (temp_len > (size_t) -1 - 1 - len) {
+            errno = UTF8_ERANGE;
+            goto fail;
+        }
+        len += temp_len;
+    }
+
+    str = va_arg(moving, char *);
+    first_len = va_arg(moving, size_t);
+    new_str = (char *) utf8c_realloc(alloc, str, sizeof(char) * (first_len + 1), sizeof(char) * (len + 1));
+    if (new_str == NULL) {
+        utf8c_free(alloc, str);
+        n_strings--;
+        errno = UTF8_ENOMEM;
+        goto fail;
+    }
+
+    new_begin = new_str;
+    new_str += first_len;
+
+    for (i = 1; i < n_strings; i++) {
+        str = va_arg(moving, char *);
+        temp_len = va_arg(moving, size_t);
+        memcpy(new_str, str, sizeof(char) * temp_len);
+        new_str += temp_len;
+        utf8c_free(alloc, str);
+    }
+    *new_str = '\0';
+    if (out_len != NULL) {
+        *out_len = len;
+    }
+    return new_begin;
+
+    fail: /* Just free strings that are left as they are invalid*/
+    for (i = 0; i < n_strings; i++) {
+        str = va_arg(moving, char *);
+        temp_len = va_arg(moving, size_t);
+        if (str != NULL) {
+            utf8c_free(alloc, str);
+        }
+    }
+    return NULL;
+}
+
+char *utf8_vmvstrcat_a(const utf8_allocator *alloc, size_t n_strings, size_t *out_len, ...) {
+    char *new_str;
+    va_list sizing, moving;
+
+    UTF8C_STAT_CALL(utf8_vmvstrcat_a, 0);
+    va_start(sizing, out_len);
+    va_start(moving, out_len);
+    new_str = vmvstrcat_pairs(alloc, n_strings, out_len, sizing, moving);
+    va_end(moving);
+    va_end(sizing);
+    return new_str;
+}
+
 char **utf8_to_arr(const char *str) {
-    size_t dist, len, i;
+    UTF8C_STAT_CALL(utf8_to_arr, 0);
+    return utf8_to_arr_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, NULL);
+}
+
+char **utf8_to_arr_n(const char *str, size_t len, size_t *out_count) {
+    UTF8C_STAT_CALL(utf8_to_arr_n, len);
+    return utf8_to_arr_a(NULL, str, len, out_count);
+}
+
+char **utf8_to_arr_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_count) {
+    size_t dist, i;
     const char *begin, *end, *next;
     char **arr, *grapheme;
 
+    UTF8C_STAT_CALL(utf8_to_arr_a, len);
     if (str == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    len = strlen(str);
     begin = &str[0];
     end = &str[len];
 
     dist = utf8_distance(begin, end);
+    UTF8C_STAT_RESUME(utf8_to_arr_a);
 
-    arr = malloc(sizeof(char *) * (dist + 1));
+    arr = utf8c_alloc(alloc, sizeof(char *) * (dist + 1));
 
     if (arr == NULL) {
         errno = UTF8_ENOMEM;
         return NULL;
     }
 
+    /* Elements are a lead octet and the continuation octets after it, as utf8_view_next cuts them, so there are
+     * exactly `dist` of them whatever the input. Continuation octets before the first lead belong to none*/
+    while (str != end && UTF8C_IS_CONT(*str)) {
+        str++;
+    }
     for (i = 0; i < dist; i++) {
-        next = utf8_next(str, end);
-        grapheme = malloc(sizeof(char) * (next - str + 1));
+        next = str + 1;
+        while (next != end && UTF8C_IS_CONT(*next)) {
+            next++;
+        }
+        UTF8C_STAT_ADD(cps, 1);
+        grapheme = utf8c_alloc(alloc, sizeof(char) * (next - str + 1));
         if (grapheme == NULL) {
             errno = UTF8_ENOMEM;
             goto fail;
@@ -455,62 +755,176 @@ char **utf8_to_arr(const char *str) {
         str = next;
     }
     arr[dist] = NULL;
+    if (out_count != NULL) {
+        *out_count = dist;
+    }
     return arr;
 
     fail:
     while (i-- > 0) {
-        free(arr[i]);
+        utf8c_free(alloc, arr[i]);
     }
-    free(arr);
+    utf8c_free(alloc, arr);
     return NULL;
 }
 
+char **utf8_to_arr_flat(const char *str) {
+    UTF8C_STAT_CALL(utf8_to_arr_flat, 0);
+    return utf8_to_arr_flat_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, NULL);
+}
+
+char **utf8_to_arr_flat_n(const char *str, size_t len, size_t *out_count) {
+    UTF8C_STAT_CALL(utf8_to_arr_flat_n, len);
+    return utf8_to_arr_flat_a(NULL, str, len, out_count);
+}
+
+char **utf8_to_arr_flat_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_count) {
+    size_t dist, i;
+    const char *end, *next;
+    char **arr, *grapheme;
+
+    UTF8C_STAT_CALL(utf8_to_arr_flat_a, len);
+    if (str == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    end = &str[len];
+    dist = utf8_distance(str, end);
+    UTF8C_STAT_RESUME(utf8_to_arr_flat_a);
+
+    /* Array of pointers followed by all the code points, each one \0 terminated*/
+    if (dist > (size_t) -1 / sizeof(char *) - 1 || dist > (size_t) -1 - sizeof(char *) * (dist + 1)
+        || len > (size_t) -1 - sizeof(char *) * (dist + 1) - dist) {
+        errno = UTF8_ERANGE;
+        return NULL;
+    }
+    arr = utf8c_alloc(alloc, sizeof(char *) * (dist + 1) + sizeof(char) * (len + dist));
+    if (arr == NULL) {
+        errno = UTF8_ENOMEM;
+        return NULL;
+    }
+
+    grapheme = (char *) &arr[dist + 1];
+    /* Same elements as utf8_to_arr_a cuts*/
+    while (str != end && UTF8C_IS_CONT(*str)) {
+        str++;
+    }
+    for (i = 0; i < dist; i++) {
+        next = str + 1;
+        while (next != end && UTF8C_IS_CONT(*next)) {
+            next++;
+        }
+        UTF8C_STAT_ADD(cps, 1);
+        arr[i] = grapheme;
+        while (str != next) {
+            *grapheme++ = *str++;
+        }
+        *grapheme++ = '\0';
+    }
+    arr[dist] = NULL;
+    if (out_count != NULL) {
+        *out_count = dist;
+    }
+    return arr;
+}
+
 void utf8_arr_free(char **arr) {
+    UTF8C_STAT_CALL(utf8_arr_free, 0);
+    utf8_arr_free_a(NULL, arr);
+}
+
+void utf8_arr_free_a(const utf8_allocator *alloc, char **arr) {
     char **arr_begin;
 
+    UTF8C_STAT_CALL(utf8_arr_free_a, 0);
     if (arr == NULL) {
         errno = UTF8_EINVAL;
         return;
     }
     arr_begin = arr;
     while (*arr != NULL) {
-        free(*arr++);
+        utf8c_free(alloc, *arr++);
     }
-    free(arr_begin);
+    utf8c_free(alloc, arr_begin);
 }
-
 char *utf8_to_str(char *const *arr) {
-    size_t len, temp_len;
-    char *const *arr_begin;
+    size_t n;
+
+    UTF8C_STAT_CALL(utf8_to_str, 0);
+    if (arr == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    for (n = 0; arr[n] != NULL; n++);
+    return utf8_to_str_a(NULL, arr, NULL, n, NULL);
+}
+
+char *utf8_to_str_n(char *const *arr, const size_t *lens, size_t n, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_to_str_n, 0);
+    return utf8_to_str_a(NULL, arr, lens, n, out_len);
+}
+
+char *utf8_to_str_a(const utf8_allocator *alloc, char *const *arr, const size_t *lens, size_t n, size_t *out_len) {
+    size_t len, i, cache[UTF8C_VSTRCAT_CACHE], *measured;
     char *new_str, *begin;
 
+    UTF8C_STAT_CALL(utf8_to_str_a, 0);
     if (arr == NULL) {
         errno = UTF8_EINVAL;
         return NULL;
     }
 
-    arr_begin = arr;
+    /* Lengths of \0 terminated elements are measured once and kept for the copy*/
+    measured = NULL;
+    if (lens == NULL) {
+        if (n <= UTF8C_VSTRCAT_CACHE) {
+            measured = cache;
+        } else if (n <= (size_t) -1 / sizeof(size_t)) {
+            measured = (size_t *) utf8c_alloc(alloc, sizeof(size_t) * n);
+        }
+        if (measured == NULL) {
+            errno = UTF8_ENOMEM;
+            return NULL;
+        }
+        for (i = 0; i < n; i++) {
+            measured[i] = utf8c_strlen(arr[i]);
+        }
+        lens = measured;
+    }
 
-    len = 0;
-    while (*arr) {
-        len += strlen(*arr++);
+    for (i = 0, len = 0; i < n; i++) {
+        if (lens[i] > (size_t) -1 - 1 - len) {
+            errno = UTF8_ERANGE;
+            goto fail;
+        }
+        len += lens[i];
     }
 
-    new_str = malloc(sizeof(char) * (len + 1));
+    new_str = utf8c_alloc(alloc, sizeof(char) * (len + 1));
     if (new_str == NULL) {
         errno = UTF8_ENOMEM;
-        return NULL;
+        goto fail;
     }
 
-    arr = arr_begin;
     begin = new_str;
-
-    while (*arr) {
-        temp_len = strlen(*arr);
-        memcpy(new_str, *arr++, sizeof(char) * temp_len);
-        new_str += temp_len;
+    for (i = 0; i < n; i++) {
+        memcpy(new_str, arr[i], sizeof(char) * lens[i]);
+        new_str += lens[i];
     }
     *new_str = '\0';
+    if (measured != NULL && measured != cache) {
+        utf8c_free(alloc, measured);
+    }
+    if (out_len != NULL) {
+        *out_len = len;
+    }
     return begin;
-}
 
+    fail:
+    if (measured != NULL && measured != cache) {
+        utf8c_free(alloc, measured);
+    }
+    return NULL;
+}
@@ -25,42 +25,110 @@ SOFTWARE.
 #define UTF8C_H 1.4f
 
 #include "stddef.h"
+#include <limits.h>
 
 /* Errno codes*/
 #define UTF8_OK     0  /* Status OK, no errors */
 #define UTF8_ENOMEM 12 /* Out of memory */
 #define UTF8_EINVAL 22 /* Invalid argument */
 #define UTF8_ERANGE 34 /* Out of range offset */
+#define UTF8_EILSEQ 84 /* Ill-formed utf-8 sequence */
 
 extern const size_t utf8_npos; /* Max possible value of len and count */
 
+/* Unsigned integer type able to hold any code point*/
+#if UINT_MAX >= 0xFFFFFFFF
+typedef unsigned int utf8_char32;
+#else
+typedef unsigned long utf8_char32;
+#endif
+
+/* Unsigned integer type able to hold any utf-16 code unit*/
+typedef unsigned short utf8_char16;
+
+/* Memory allocator used by `_a` functions instead of malloc/realloc/free. Passing NULL instead of a pointer
+ * to an allocator means malloc/realloc/free. Callbacks receive `ctx` as the first argument*/
+typedef struct utf8_allocator {
+    void *(*alloc)(void *ctx, size_t size);     /* Same as malloc*/
+    void *(*resize)(void *ctx, void *ptr, size_t old_size, size_t new_size); /* Same as realloc, only
+                                                 * first `old_size` octets of `ptr` have to be preserved*/
+    void (*release)(void *ctx, void *ptr);      /* Same as free*/
+    void *ctx;
+} utf8_allocator;
+
+/* Default size of utf8_arena block*/
+#define UTF8_ARENA_BLOCK 65536
+
+/* Bump-pointer allocator, see utf8_arena_init. Allocations are aligned for any pointer, size_t, long or double.
+ * Individual allocations are not freed, but all of them can be dropped at once with utf8_arena_reset*/
+typedef struct utf8_arena {
+    utf8_allocator allocator;           /* Pass &arena.allocator to `_a` functions*/
+    size_t block_size;                  /* Number of octets requested from malloc at once*/
+    struct utf8_arena_block *blocks;    /* Blocks in use, the current one first*/
+    struct utf8_arena_block *spare;     /* Blocks dropped by utf8_arena_reset, to be reused*/
+} utf8_arena;
+
+/* `arena`  - pointer to an arena to initialize. MUST NOT BE COPIED afterwards, `allocator` points to it
+ * `block_size` - number of octets to request from malloc at once, 0 for UTF8_ARENA_BLOCK.
+ *     Bigger allocations get a block of their own*/
+void utf8_arena_init(utf8_arena *arena, size_t block_size);
+
+/* `arena`  - pointer to an initialized arena.
+ *     Invalidates everything allocated from the arena at once, but keeps its memory for the next allocations*/
+void utf8_arena_reset(utf8_arena *arena);
+
+/* `arena`  - pointer to an initialized arena.
+ *     Invalidates everything allocated from the arena and gives its memory back with free.
+ *     The arena stays initialized and can be used again*/
+void utf8_arena_release(utf8_arena *arena);
+
 /* `begin`  - pointer to a string
  * `end`    - pointer to a string which we will not go beyond. Can also be a pointer to \0
- * return   - pointer to a first octet of a next grapheme after `begin` or NULL if `begin` is the `end`*/
+ * return   - pointer to a first octet of a next code point after `begin` or NULL if `begin` is the `end`.
+ *     See utf8_grapheme_next for user-perceived characters*/
 char *utf8_next(const char *begin, const char *end);
 
-/* `begin`  - pointer to any octet of a valid grapheme
+/* `begin`  - pointer to any octet of a valid code point
  * `end`    - pointer to a string which we will not go beyond.
- * return   - pointer to a first octet of a prior grapheme before `begin` or NULL if `begin` is the `end`*/
+ * return   - pointer to a first octet of a prior code point before `begin` or NULL if `begin` is the `end`*/
 char *utf8_prior(const char *begin, const char *end);
 
 /* `begin`  - pointer to a string
  * `end`    - pointer to a string which we will not go beyond.
  * `n`      - number of code points to advance `begin`
- * return   - pointer to a first octet of grapheme advanced for `n` or NULL if `n` is too big*/
+ * return   - pointer to a first octet of code point advanced for `n` or NULL if `n` is too big*/
 char *utf8_advance(const char *begin, size_t n, const char *end);
 
+/* `begin`  - pointer to a string
+ * `end`    - pointer to a string which we will not go beyond. Can also be a pointer to \0
+ * `error_offset` - pointer to a variable that receives the offset of the first octet of the first ill-formed
+ *     sequence (overlong, surrogate, above U+10FFFF, stray continuation octet or truncated sequence) or NULL
+ * return   - UTF8_OK if [`begin`, `end`) is valid utf-8, UTF8_EILSEQ otherwise.
+ *     Once validated, the string can be safely passed to the rest of the functions*/
+int utf8_validate(const char *begin, const char *end, size_t *error_offset);
 
 /* `str`    - pointer to a string, must be \0 terminated
  * `n`      - number of times to repeat `str`
  * return   - pointer to the beginning of DYNAMICALLY allocated copy of `str` repeated for `n`
- *     times or NULL if allocation fails. MUST BE FREED MANUALLY*/
+ *     times or NULL if allocation fails or the result is too big to fit into memory,
+ *     errno is set to UTF8_ENOMEM or UTF8_ERANGE then. MUST BE FREED MANUALLY*/
 char *utf8_repeat(const char *str, size_t n);
 
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `n`      - number of times to repeat `str`
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_repeat*/
+char *utf8_repeat_n(const char *str, size_t len, size_t n, size_t *out_len);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_repeat_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_repeat_a(const utf8_allocator *alloc, const char *str, size_t len, size_t n, size_t *out_len);
+
 
 /* `begin`  - pointer to a string
  * `end`    - pointer to a string which we will not go beyond. Can also be a pointer to \0
- * return   - a number of graphemes between `start` and `end`*/
+ * return   - a number of code points between `start` and `end`. See utf8_grapheme_count for user-perceived characters*/
 size_t utf8_distance(const char *begin, const char *end);
 
 /* `str`    - pointer to a string, must be \0 terminated AND NOT READ-ONLY
@@ -69,10 +137,33 @@ size_t utf8_distance(const char *begin, const char *end);
  * return   - pointer to a first octet of reversed string*/
 char *utf8_reverse(char str[]);
 
+/* `str`    - pointer to a string, doesn't have to be \0 terminated, MUST NOT BE READ-ONLY
+ * `len`    - number of octets in `str`
+ * return   - same as utf8_reverse*/
+char *utf8_reverse_n(char *str, size_t len);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `dst`    - pointer to a buffer of at least `len` + 1 octets that receives reversed `str` and \0.
+ *     Must not overlap with `str`
+ * return   - `dst`*/
+char *utf8_reverse_to(const char *str, size_t len, char *dst);
+
 /* `str`    - pointer to a string, must be \0 terminated
  * return   - pointer to the beginning of DYNAMICALLY allocated copy of `str`. MUST BE FREED MANUALLY*/
 char *utf8_strcpy(const char *str);
 
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - pointer to the beginning of DYNAMICALLY allocated \0 terminated copy of `len` octets of `str`.
+ *     MUST BE FREED MANUALLY*/
+char *utf8_strcpy_n(const char *str, size_t len, size_t *out_len);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_strcpy_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_strcpy_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len);
+
 /* `str`    - pointer to a string, must be \0 terminated
  * `off`    - number of offset code points to advance starting from `str` beginning
  * `count`  - number of code points to include starting from `off`
@@ -80,18 +171,59 @@ char *utf8_strcpy(const char *str);
  *     or NULL if allocation fails. MUST BE FREED MANUALLY*/
 char *utf8_substr(const char *str, size_t off, size_t count);
 
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `off`    - number of offset code points to advance starting from `str` beginning
+ * `count`  - number of code points to include starting from `off`
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_substr*/
+char *utf8_substr_n(const char *str, size_t len, size_t off, size_t count, size_t *out_len);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_substr_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_substr_a(const utf8_allocator *alloc, const char *str, size_t len, size_t off, size_t count,
+                    size_t *out_len);
+
 /* `str`    - pointer to a string, must be \0 terminated
  * `joiner` - pointer to a valid first octet of a string to be joined, must be \0 terminated`
- * return   - pointer to the beginning of DYNAMICALLY allocated copy of `str` joined with `joiner`
- *     or NULL if allocation fails. MUST BE FREED MANUALLY*/
+ * return   - pointer to the beginning of DYNAMICALLY allocated copy of `str` with `joiner` before every
+ *     code point but the first or NULL if allocation fails or the result is too big to fit into memory,
+ *     errno is set to UTF8_ENOMEM or UTF8_ERANGE then. MUST BE FREED MANUALLY*/
 char *utf8_join(const char *str, const char *joiner);
 
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `joiner` - pointer to a string to be joined, doesn't have to be \0 terminated
+ * `joiner_len` - number of octets in `joiner`
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_join*/
+char *utf8_join_n(const char *str, size_t len, const char *joiner, size_t joiner_len, size_t *out_len);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_join_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_join_a(const utf8_allocator *alloc, const char *str, size_t len, const char *joiner, size_t joiner_len,
+                  size_t *out_len);
+
 /* `a`      - pointer to a string, must be \0 terminated
  * `b`      - pointer to a string, must be \0 terminated
  * return   - pointer to the beginning of DYNAMICALLY allocated copy of `a` and `b` concatenated together
  *     or NULL if allocation fails. MUST BE FREED MANUALLY*/
 char *utf8_strcat(const char *a, const char *b);
 
+/* `a`      - pointer to a string, doesn't have to be \0 terminated
+ * `len_a`  - number of octets in `a`
+ * `b`      - pointer to a string, doesn't have to be \0 terminated
+ * `len_b`  - number of octets in `b`
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_strcat, or NULL if the result is too big to fit into memory,
+ *     errno is set to UTF8_ERANGE then*/
+char *utf8_strcat_n(const char *a, size_t len_a, const char *b, size_t len_b, size_t *out_len);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_strcat_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_strcat_a(const utf8_allocator *alloc, const char *a, size_t len_a, const char *b, size_t len_b,
+                    size_t *out_len);
+
 /* `a`      - pointer to a string, must be \0 terminated AND DYNAMICALLY ALLOCATED
  * `b`      - pointer to a string, must be \0 terminated AND DYNAMICALLY ALLOCATED
  * return   - pointer to the beginning of DYNAMICALLY allocated copy of `a` and `b` concatenated together
@@ -99,12 +231,32 @@ char *utf8_strcat(const char *a, const char *b);
  *     they're moved to the new string*/
 char *utf8_mvstrcat(char *a, char *b);
 
+/* `alloc`  - pointer to an allocator `a` and `b` were allocated with or NULL for malloc
+ * `len_a`  - number of octets in `a` (without \0)
+ * `len_b`  - number of octets in `b` (without \0)
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_mvstrcat, but allocated with `alloc`. MUST BE FREED with `alloc`.
+ *     NULL if the result is too big to fit into memory, errno is set to UTF8_ERANGE and `a` and `b` are freed then*/
+char *utf8_mvstrcat_a(const utf8_allocator *alloc, char *a, size_t len_a, char *b, size_t len_b, size_t *out_len);
+
 /* `n_str`  - number of input strings
  * `... `   - pointers to valid strings
  * return   - pointer to the beginning of DYNAMICALLY allocated copy of strings concatenated together
  *     or NULL if allocation fails. MUST BE FREED MANUALLY*/
 char *utf8_vstrcat(size_t n_str, ...);
 
+/* `n_str`  - number of input strings
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * `... `   - `n_str` pairs of a pointer to a string (doesn't have to be \0 terminated)
+ *     and its number of octets, which MUST BE OF size_t TYPE, e.g. (size_t) 4
+ * return   - same as utf8_vstrcat, or NULL if the result is too big to fit into memory,
+ *     errno is set to UTF8_ERANGE then*/
+char *utf8_vstrcat_n(size_t n_str, size_t *out_len, ...);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_vstrcat_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_vstrcat_a(const utf8_allocator *alloc, size_t n_str, size_t *out_len, ...);
+
 /* `n_str`  - number of input strings
  * `... `   - pointers to valid strings, strings must be \0 terminated AND DYNAMICALLY ALLOCATED
  * return   - pointer to the beginning of DYNAMICALLY allocated copy of strings concatenated together
@@ -112,9 +264,18 @@ char *utf8_vstrcat(size_t n_str, ...);
  *     they're moved to the new string*/
 char *utf8_vmvstrcat(size_t n_strings, ...);
 
+/* `alloc`  - pointer to an allocator strings were allocated with or NULL for malloc
+ * `n_strings` - number of input strings
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * `... `   - `n_strings` pairs of a pointer to a string and its number of octets (without \0),
+ *     which MUST BE OF size_t TYPE
+ * return   - same as utf8_vmvstrcat, but allocated with `alloc`. MUST BE FREED with `alloc`.
+ *     NULL if the result is too big to fit into memory, errno is set to UTF8_ERANGE and the strings are freed then*/
+char *utf8_vmvstrcat_a(const utf8_allocator *alloc, size_t n_strings, size_t *out_len, ...);
+
 /* `str`    - pointer to a string, must be \0 terminated
  * return   - pointer to the beginning of DYNAMICALLY allocated array of strings extracted from `str`.
- *     Every string is a valid standalone utf8 grapheme(visible "character") to be printed.
+ *     Every string is a single code point, see utf8_grapheme_to_arr for whole user-perceived characters.
  *       Must be exactly utf8_distance(`str`) + 1 length and each element must be \0 terminated string
  *       + last element will be NULL.
  *       in <- "аabcㅊ"
@@ -126,15 +287,653 @@ char *utf8_vmvstrcat(size_t n_strings, ...);
  *           "ㅊ\0" (three-byte("\xe3\x85\x8a") Hangul "ㅊ"),
  *           NULL
  *          ]
- *     or NULL pointer if allocation fails. MUST BE FREED MANUALLY with utf8_array_free */
+ *     or NULL pointer if allocation fails. MUST BE FREED MANUALLY with utf8_array_free.
+ *     Elements of ill-formed input are cut like utf8_view_next cuts them, continuation octets before
+ *     the first lead octet aren't part of any*/
 char **utf8_to_arr(const char *str);
 
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `out_count` - pointer to a variable that receives the number of elements (without the last NULL) or NULL
+ * return   - same as utf8_to_arr*/
+char **utf8_to_arr_n(const char *str, size_t len, size_t *out_count);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_to_arr_n, but allocated with `alloc`. MUST BE FREED MANUALLY with utf8_arr_free_a*/
+char **utf8_to_arr_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_count);
+
+/* `str`    - pointer to a string, must be \0 terminated
+ * return   - same array as utf8_to_arr returns, but the array and all of its strings are placed in a single
+ *     DYNAMICALLY allocated block, or NULL if the block is too big to fit into memory, errno is set to UTF8_ERANGE
+ *     then. MUST BE FREED MANUALLY with free, NOT with utf8_arr_free*/
+char **utf8_to_arr_flat(const char *str);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `out_count` - pointer to a variable that receives the number of elements (without the last NULL) or NULL
+ * return   - same as utf8_to_arr_flat*/
+char **utf8_to_arr_flat_n(const char *str, size_t len, size_t *out_count);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_to_arr_flat_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char **utf8_to_arr_flat_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_count);
+
 /* `arr`    - pointer to a valid array allocated with utf8_to_array. MUST CORRESPOND to each utf8_to_array usage*/
 void utf8_arr_free(char **arr);
 
+/* `alloc`  - pointer to an allocator `arr` was allocated with or NULL for malloc
+ * `arr`    - pointer to a valid array allocated with utf8_to_arr_a*/
+void utf8_arr_free_a(const utf8_allocator *alloc, char **arr);
+
 /* `arr`    - pointer to a valid array allocated with utf8_to_array.
  * return   - pointer to the beginning of DYNAMICALLY allocated string created from `arr`
  *     or NULL if allocation fails. MUST BE FREED MANUALLY*/
 char *utf8_to_str(char *const *arr);
 
+/* `arr`    - pointer to an array of strings, doesn't have to be NULL terminated
+ * `lens`   - pointer to an array of numbers of octets in each of `arr` elements
+ *     or NULL if every element is \0 terminated
+ * `n`      - number of elements in `arr`
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_to_str, or NULL if the result is too big to fit into memory,
+ *     errno is set to UTF8_ERANGE then*/
+char *utf8_to_str_n(char *const *arr, const size_t *lens, size_t n, size_t *out_len);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_to_str_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_to_str_a(const utf8_allocator *alloc, char *const *arr, const size_t *lens, size_t n, size_t *out_len);
+
+/* Default number of code points between two checkpoints of utf8_index*/
+#define UTF8_INDEX_STEP 256
+
+/* Code point offset index of a string, see utf8_index_create.
+ * Takes sizeof(size_t) octets per `step` code points on top of the header*/
+typedef struct utf8_index {
+    const utf8_allocator *alloc; /* Allocator the index was allocated with*/
+    const char *str;        /* Indexed string, not owned by the index*/
+    size_t len;             /* Number of octets in `str`*/
+    size_t n_cps;           /* Number of code points in `str`*/
+    size_t step;            /* Number of code points between two checkpoints*/
+    size_t n_checkpoints;   /* Number of elements in `checkpoints`*/
+    size_t *checkpoints;    /* Octet offset of every `step`th code point of `str`*/
+} utf8_index;
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated. Must stay valid and unchanged while index is used
+ * `len`    - number of octets in `str`
+ * `step`   - number of code points between checkpoints, 0 for UTF8_INDEX_STEP. Smaller is faster, but takes more memory
+ * return   - pointer to DYNAMICALLY allocated index of `str` or NULL if allocation fails.
+ *     MUST BE FREED MANUALLY with utf8_index_free*/
+utf8_index *utf8_index_create(const char *str, size_t len, size_t step);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc. Must stay valid until the index is freed
+ * return   - same as utf8_index_create, but allocated with `alloc`*/
+utf8_index *utf8_index_create_a(const utf8_allocator *alloc, const char *str, size_t len, size_t step);
+
+/* `index`  - pointer to a valid index allocated with utf8_index_create*/
+void utf8_index_free(utf8_index *index);
+
+/* `index`  - pointer to a valid index
+ * `off`    - number of code points to advance starting from the beginning of indexed string
+ * return   - pointer to a first octet of `off`th code point (or to the end of string if `off` is the number of code points)
+ *     or NULL if `off` is too big. Takes at most `step` code points to scan*/
+char *utf8_index_advance(const utf8_index *index, size_t off);
+
+/* `index`  - pointer to a valid index
+ * `it`     - pointer to a first octet of a code point of indexed string or to its end
+ * return   - number of code points between the beginning of indexed string and `it`
+ *     or utf8_npos if `it` is out of string bounds. Takes a binary search and at most `step` code points to scan*/
+size_t utf8_index_offset(const utf8_index *index, const char *it);
+
+/* `index`  - pointer to a valid index
+ * `off`    - number of offset code points to advance starting from the beginning of indexed string
+ * `count`  - number of code points to include starting from `off`
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_substr*/
+char *utf8_index_substr(const utf8_index *index, size_t off, size_t count, size_t *out_len);
+
+/* Initial capacity of utf8_builder, in octets*/
+#define UTF8_BUILDER_MIN_CAP 16
+
+/* String builder with amortized growth, see utf8_builder_init. All fields are read-only*/
+typedef struct utf8_builder {
+    const utf8_allocator *alloc; /* Allocator of `data`*/
+    char *data;     /* \0 terminated string built so far or NULL if nothing was allocated yet*/
+    size_t len;     /* Number of octets in `data` (without \0)*/
+    size_t n_cps;   /* Number of code points in `data`*/
+    size_t cap;     /* Number of octets allocated for `data` (with \0)*/
+} utf8_builder;
+
+/* `builder` - pointer to a builder to initialize. Doesn't allocate anything
+ * `alloc`  - pointer to an allocator to use or NULL for malloc. Must stay valid while the builder is used*/
+void utf8_builder_init(utf8_builder *builder, const utf8_allocator *alloc);
+
+/* `builder` - pointer to an initialized builder
+ * `n`      - number of octets to make room for, on top of what's already appended
+ * return   - UTF8_OK, UTF8_ERANGE if the builder would be too big to fit into memory or UTF8_ENOMEM
+ *     if allocation fails. Capacity at least doubles on every growth*/
+int utf8_builder_reserve(utf8_builder *builder, size_t n);
+
+/* `builder` - pointer to an initialized builder
+ * `str`    - pointer to a string to append, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * return   - UTF8_OK, UTF8_ERANGE if the result is too big to fit into memory or UTF8_ENOMEM if allocation fails,
+ *     in which case the builder stays unchanged*/
+int utf8_builder_append(utf8_builder *builder, const char *str, size_t len);
+
+/* `builder` - pointer to an initialized builder
+ * `cp`     - code point to append
+ * return   - UTF8_OK, UTF8_EILSEQ if `cp` is a surrogate or above U+10FFFF, UTF8_ERANGE if the result is too big
+ *     to fit into memory or UTF8_ENOMEM if allocation fails*/
+int utf8_builder_append_cp(utf8_builder *builder, utf8_char32 cp);
+
+/* `builder` - pointer to an initialized builder
+ * `str`    - pointer to a string to append, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `n`      - number of times to append `str`
+ * return   - UTF8_OK, UTF8_ERANGE if the result is too big to fit into memory or UTF8_ENOMEM if allocation fails*/
+int utf8_builder_append_repeat(utf8_builder *builder, const char *str, size_t len, size_t n);
+
+/* `builder` - pointer to an initialized builder
+ * `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `joiner` - pointer to a string to put between code points of `str`, doesn't have to be \0 terminated
+ * `joiner_len` - number of octets in `joiner`
+ * return   - UTF8_OK, UTF8_ERANGE if the result is too big to fit into memory or UTF8_ENOMEM if allocation fails.
+ *     Appends the same string utf8_join_n creates*/
+int utf8_builder_append_join(utf8_builder *builder, const char *str, size_t len, const char *joiner, size_t joiner_len);
+
+/* `builder` - pointer to an initialized builder, becomes empty again
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - pointer to the beginning of DYNAMICALLY allocated string built so far or NULL if allocation fails.
+ *     MUST BE FREED MANUALLY with the builder's allocator (free if it's NULL)*/
+char *utf8_builder_finish(utf8_builder *builder, size_t *out_len);
+
+/* `builder` - pointer to an initialized builder, becomes empty again.
+ *     Frees the string built so far*/
+void utf8_builder_free(utf8_builder *builder);
+
+/* Incremental decoder state for input that comes in chunks, see utf8_stream_init. All fields are read-only*/
+typedef struct utf8_stream {
+    size_t n_bytes;         /* Number of octets fed so far*/
+    size_t n_cps;           /* Number of code points in octets returned as boundary-safe so far*/
+    size_t error_offset;    /* Offset of the first octet of the first ill-formed sequence from the beginning
+                             * of the stream or utf8_npos if everything fed so far is valid*/
+    char head[4];           /* Octets of previous chunks which complete with the beginning of the last chunk*/
+    size_t head_len;        /* Number of octets in `head`*/
+    char pending[4];        /* Incomplete sequence at the end of the octets fed so far*/
+    size_t pending_len;     /* Number of octets in `pending`*/
+} utf8_stream;
+
+/* `stream` - pointer to a stream to initialize*/
+void utf8_stream_init(utf8_stream *stream);
+
+/* `stream` - pointer to an initialized stream
+ * `chunk`  - pointer to the next chunk of input, doesn't have to be \0 terminated. Isn't referenced after the call
+ * `len`    - number of octets in `chunk`
+ * return   - number of octets at the beginning of `chunk` which, preceded by `head_len` octets of `head`,
+ *     end on a code point boundary. The rest is kept in `pending` until the next chunk.
+ *     Validates and counts code points on the way, see `error_offset` and `n_cps`*/
+size_t utf8_stream_feed(utf8_stream *stream, const char *chunk, size_t len);
+
+/* `stream` - pointer to an initialized stream, no more chunks will be fed
+ * return   - UTF8_OK if the whole stream is valid utf-8, UTF8_EILSEQ otherwise.
+ *     Moves a sequence left incomplete by the end of the stream to `head`, so it can be output*/
+int utf8_stream_finish(utf8_stream *stream);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * return   - exact number of utf-32 code units utf8_to_utf32 writes for well-formed `str`*/
+size_t utf8_utf32_len(const char *str, size_t len);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * return   - exact number of utf-16 code units utf8_to_utf16 writes for well-formed `str`*/
+size_t utf8_utf16_len(const char *str, size_t len);
+
+/* `src`    - pointer to utf-32 code units
+ * `n`      - number of code units in `src`
+ * return   - exact number of octets utf8_from_utf32 writes or utf8_npos if `src` holds a surrogate or a value
+ *     above U+10FFFF, errno is set to UTF8_EILSEQ then*/
+size_t utf8_len_from_utf32(const utf8_char32 *src, size_t n);
+
+/* `src`    - pointer to utf-16 code units
+ * `n`      - number of code units in `src`
+ * return   - exact number of octets utf8_from_utf16 writes or utf8_npos if `src` holds an unpaired surrogate,
+ *     errno is set to UTF8_EILSEQ then*/
+size_t utf8_len_from_utf16(const utf8_char16 *src, size_t n);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `dst`    - pointer to a buffer that receives utf-32 code units, nothing is appended after them
+ * `cap`    - number of code units `dst` can hold, utf8_utf32_len is always enough
+ * return   - number of code units written to `dst` or utf8_npos on error, with errno set to
+ *     UTF8_EILSEQ if `str` is ill-formed or UTF8_ERANGE if `dst` is too small. Part of the result
+ *     may be written to `dst` anyway*/
+size_t utf8_to_utf32(const char *str, size_t len, utf8_char32 *dst, size_t cap);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `dst`    - pointer to a buffer that receives utf-16 code units, nothing is appended after them
+ * `cap`    - number of code units `dst` can hold, utf8_utf16_len is always enough
+ * return   - same as utf8_to_utf32, code points above U+FFFF are written as surrogate pairs*/
+size_t utf8_to_utf16(const char *str, size_t len, utf8_char16 *dst, size_t cap);
+
+/* `src`    - pointer to utf-32 code units
+ * `n`      - number of code units in `src`
+ * `dst`    - pointer to a buffer that receives a utf-8 string, \0 isn't appended
+ * `cap`    - number of octets `dst` can hold, utf8_len_from_utf32 is always enough
+ * return   - number of octets written to `dst` or utf8_npos on error, with errno set to UTF8_EILSEQ
+ *     if `src` holds a surrogate or a value above U+10FFFF or UTF8_ERANGE if `dst` is too small.
+ *     Part of the result may be written to `dst` anyway*/
+size_t utf8_from_utf32(const utf8_char32 *src, size_t n, char *dst, size_t cap);
+
+/* `src`    - pointer to utf-16 code units
+ * `n`      - number of code units in `src`
+ * `dst`    - pointer to a buffer that receives a utf-8 string, \0 isn't appended
+ * `cap`    - number of octets `dst` can hold, utf8_len_from_utf16 is always enough
+ * return   - same as utf8_from_utf32, but UTF8_EILSEQ means an unpaired surrogate*/
+size_t utf8_from_utf16(const utf8_char16 *src, size_t n, char *dst, size_t cap);
+
+/* Non-owning reference to a part of a string. Functions taking views never allocate or copy.
+ * On errors they return a view with `ptr` set to NULL and set errno*/
+typedef struct utf8_view {
+    const char *ptr;    /* First octet of the view, doesn't have to be \0 terminated*/
+    size_t len;         /* Number of octets in the view*/
+} utf8_view;
+
+/* `str`    - pointer to a string, must be \0 terminated
+ * return   - view of the whole `str`, without \0*/
+utf8_view utf8_view_of(const char *str);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * return   - view of `len` octets of `str`*/
+utf8_view utf8_view_n(const char *str, size_t len);
+
+/* `view`   - view of a string
+ * return   - number of code points in `view`*/
+size_t utf8_view_distance(utf8_view view);
+
+/* `view`   - view of a string
+ * `n`      - number of code points to drop from the beginning of `view`
+ * return   - rest of `view` or a NULL view if `view` has less than `n` code points, errno is set to UTF8_ERANGE*/
+utf8_view utf8_view_advance(utf8_view view, size_t n);
+
+/* `view`   - view of a string
+ * `off`    - number of offset code points to advance starting from `view` beginning
+ * `count`  - number of code points to include starting from `off`, utf8_npos or more than left means the rest
+ * return   - same as utf8_substr, but a view into `view` instead of a copy*/
+utf8_view utf8_view_substr(utf8_view view, size_t off, size_t count);
+
+/* `view`   - pointer to a view of a string, its first code point is removed from it
+ * return   - view of the removed code point or an empty view if `view` is empty*/
+utf8_view utf8_view_next(utf8_view *view);
+
+/* `view`   - pointer to a view of a string, its last code point is removed from it
+ * return   - view of the removed code point or an empty view if `view` is empty*/
+utf8_view utf8_view_prior(utf8_view *view);
+
+/* `view`   - pointer to a view of a string, its first line is removed from it
+ * return   - view of the removed line with its \n (and \r before it, if any), the last line may have none.
+ *     An empty view once `view` is empty*/
+utf8_view utf8_view_next_line(utf8_view *view);
+
+/* `view`   - view of a string
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_strcpy_n for the octets of `view`. MUST BE FREED MANUALLY*/
+char *utf8_view_str(utf8_view view, size_t *out_len);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_view_str, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_view_str_a(const utf8_allocator *alloc, utf8_view view, size_t *out_len);
+
+/* Flags of the utf8_split_init functions*/
+#define UTF8_SPLIT_SKIP_EMPTY 1 /* Don't yield empty pieces, e.g. between two delimiters in a row*/
+
+/* Iterator over the pieces of a string between delimiters, see utf8_split_init. Pieces are views into the
+ * string, nothing is allocated or copied. All fields are read-only*/
+typedef struct utf8_split {
+    utf8_view rest;             /* Part of the string that's not split yet*/
+    const char *delim;          /* Delimiter string or set of code points, NULL for a code point delimiter*/
+    size_t delim_len;           /* Number of octets in `delim` or in `cp`*/
+    char cp[4];                 /* Code point delimiter, encoded*/
+    unsigned int flags;
+    int done;                   /* Whether the last piece was returned*/
+    unsigned char firsts[16];   /* Distinct first octets of the code points of a set*/
+    size_t n_firsts;            /* Number of them, more than 16 means only `first_bits` are used*/
+    unsigned char first_bits[32]; /* Same octets, one bit per octet value*/
+    unsigned long hits;         /* Octets of `rest` known to be among `firsts`, one bit per octet*/
+    size_t span;                /* Number of octets at the beginning of `rest` that `hits` covers*/
+} utf8_split;
+
+/* `split`  - pointer to an iterator to initialize
+ * `str`    - pointer to a string to split, doesn't have to be \0 terminated. Must outlive the iterator
+ * `len`    - number of octets in `str`
+ * `delim`  - pointer to a delimiter string, doesn't have to be \0 terminated. Must outlive the iterator
+ * `delim_len` - number of octets in `delim`, can't be 0
+ * `flags`  - 0 or UTF8_SPLIT_SKIP_EMPTY
+ * return   - UTF8_OK or UTF8_EINVAL. Occurrences of `delim` are matched like utf8_find does, so n of them split
+ *     `str` into n + 1 pieces, an empty string is one empty piece*/
+int utf8_split_init(utf8_split *split, const char *str, size_t len, const char *delim, size_t delim_len,
+                    unsigned int flags);
+
+/* `cp`     - delimiter code point
+ * return   - same as utf8_split_init, or UTF8_EILSEQ if `cp` is a surrogate or above U+10FFFF*/
+int utf8_split_init_cp(utf8_split *split, const char *str, size_t len, utf8_char32 cp, unsigned int flags);
+
+/* `set`    - pointer to a valid utf-8 string, each of its code points is a delimiter. Must outlive the iterator
+ * `set_len` - number of octets in `set`, can't be 0
+ * return   - same as utf8_split_init, e.g. a set of " \t\n" and UTF8_SPLIT_SKIP_EMPTY splits `str` into words*/
+int utf8_split_init_set(utf8_split *split, const char *str, size_t len, const char *set, size_t set_len,
+                        unsigned int flags);
+
+/* `split`  - pointer to an initialized iterator
+ * `piece`  - pointer to a view that receives the next piece, without its delimiter
+ * return   - 1 if a piece was written to `piece`, 0 once there are no more pieces or on errors (errno is set then)*/
+int utf8_split_next(utf8_split *split, utf8_view *piece);
+
+/* `begin`  - pointer to the first octet of an extended grapheme cluster
+ * `end`    - pointer to a string which we will not go beyond. Can also be a pointer to \0
+ * return   - pointer to the first octet of the next extended grapheme cluster (UAX #29), e.g. a letter with
+ *     its combining marks, a flag or an emoji ZWJ sequence, or `end`. NULL if `begin` is `end`*/
+char *utf8_grapheme_next(const char *begin, const char *end);
+
+/* `begin`  - pointer to a string
+ * `end`    - pointer past the last octet of the string
+ * return   - number of extended grapheme clusters between `begin` and `end`*/
+size_t utf8_grapheme_count(const char *begin, const char *end);
+
+/* `str`    - pointer to a string, must be \0 terminated
+ * return   - same as utf8_to_arr, but every string is a whole extended grapheme cluster instead of
+ *     a code point. MUST BE FREED MANUALLY with utf8_arr_free*/
+char **utf8_grapheme_to_arr(const char *str);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `out_count` - pointer to a variable that receives the number of elements (without the last NULL) or NULL
+ * return   - same as utf8_grapheme_to_arr*/
+char **utf8_grapheme_to_arr_n(const char *str, size_t len, size_t *out_count);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_grapheme_to_arr_n, but allocated with `alloc`. MUST BE FREED with utf8_arr_free_a*/
+char **utf8_grapheme_to_arr_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_count);
+
+/* Instruction sets of the kernels behind counting, validation, reversal and transcoding*/
+#define UTF8_ISA_SCALAR 0 /* Portable C, 8 octets at a time */
+#define UTF8_ISA_SSE2   1
+#define UTF8_ISA_SSSE3  2
+#define UTF8_ISA_AVX2   3
+#define UTF8_ISA_AVX512 4 /* AVX-512F with AVX-512BW */
+
+/* return   - best instruction set supported by both the CPU and the build, UTF8_ISA_SCALAR off x86*/
+int utf8_detect_isa(void);
+
+/* return   - instruction set in use. Picked on the first call into the library: the one named by
+ *     the UTF8C_ISA environment variable (scalar, sse2, ssse3, avx2 or avx512) if it is supported, otherwise
+ *     utf8_detect_isa()*/
+int utf8_get_isa(void);
+
+/* Switches kernels to another instruction set, mostly for benchmarks and tests. Not thread-safe:
+ * no other thread may be inside the library
+ * `isa`    - one of UTF8_ISA_*
+ * return   - UTF8_OK or UTF8_EINVAL if `isa` is unknown or above utf8_detect_isa()*/
+int utf8_set_isa(int isa);
+
+/* `isa`    - one of UTF8_ISA_*
+ * return   - lowercase name of `isa` as accepted by UTF8C_ISA or NULL if `isa` is unknown*/
+const char *utf8_isa_name(int isa);
+
+/* Runs independent tasks, possibly on several threads at once. The *_mt functions split their input into
+ * at most `n_threads` chunks of at least 1 MB and hand them to an executor, smaller inputs are processed inline*/
+typedef struct utf8_executor {
+    /* Calls `task(arg, i)` once for every `i` in [0, `n`), in any order and on any threads, and returns after
+     * all the calls returned and their results are visible to the calling thread*/
+    void (*run)(void *ctx, void (*task)(void *arg, size_t i), void *arg, size_t n);
+    void *ctx;          /* Passed to `run` */
+    size_t n_threads;   /* Number of tasks that can run at once */
+} utf8_executor;
+
+/* return   - executor over a built-in pool of threads, one per CPU (or UTF8C_THREADS if that environment variable
+ *     is set), started on the first call. Runs tasks on the calling thread if the library is built without threads
+ *     or another thread's tasks are already running*/
+const utf8_executor *utf8_default_executor(void);
+
+/* `exec`   - pointer to an executor to use or NULL for utf8_default_executor()
+ * return   - same as utf8_distance*/
+size_t utf8_distance_mt(const utf8_executor *exec, const char *begin, const char *end);
+
+/* `exec`   - pointer to an executor to use or NULL for utf8_default_executor()
+ * return   - same as utf8_validate, `error_offset` is the first error in the whole string*/
+int utf8_validate_mt(const utf8_executor *exec, const char *begin, const char *end, size_t *error_offset);
+
+/* `exec`   - pointer to an executor to use or NULL for utf8_default_executor()
+ * return   - same as utf8_to_utf32, including which error is reported when there are several*/
+size_t utf8_to_utf32_mt(const utf8_executor *exec, const char *str, size_t len, utf8_char32 *dst, size_t cap);
+
+/* `exec`   - pointer to an executor to use or NULL for utf8_default_executor()
+ * return   - same as utf8_to_utf16*/
+size_t utf8_to_utf16_mt(const utf8_executor *exec, const char *str, size_t len, utf8_char16 *dst, size_t cap);
+
+/* `exec`   - pointer to an executor to use or NULL for utf8_default_executor()
+ * return   - same as utf8_from_utf32*/
+size_t utf8_from_utf32_mt(const utf8_executor *exec, const utf8_char32 *src, size_t n, char *dst, size_t cap);
+
+/* `exec`   - pointer to an executor to use or NULL for utf8_default_executor()
+ * return   - same as utf8_from_utf16, a surrogate pair is never split between threads*/
+size_t utf8_from_utf16_mt(const utf8_executor *exec, const utf8_char16 *src, size_t n, char *dst, size_t cap);
+
+/* Read-only file mapped into memory. Functions taking it work on the mapping in place,
+ * no copy or \0 terminator is needed*/
+typedef struct utf8_file {
+    const char *data;   /* First octet of the file, isn't \0 terminated. NULL if the file isn't open*/
+    size_t len;         /* Number of octets in the file*/
+} utf8_file;
+
+/* `file`   - pointer to a file to initialize
+ * `path`   - path of a file to map, read-only. Later changes of the file may or may not show through the mapping
+ * return   - UTF8_OK, UTF8_ERANGE if the file doesn't fit into memory or errno of the failed system call
+ *     (e.g. ENOENT or EACCES), in which case `file->data` is NULL. MUST BE CLOSED with utf8_file_close*/
+int utf8_file_open(utf8_file *file, const char *path);
+
+/* `file`   - pointer to an open file or one that failed to open, unmapped and reset.
+ *     Views of the file mustn't be used after that*/
+void utf8_file_close(utf8_file *file);
+
+/* `file`   - pointer to an open file
+ * return   - view of the whole file, see utf8_view_next_line to iterate over its lines*/
+utf8_view utf8_file_view(const utf8_file *file);
+
+/* `file`   - pointer to an open file
+ * return   - number of code points in the file, counted on the utf8_default_executor() threads*/
+size_t utf8_file_distance(const utf8_file *file);
+
+/* `file`   - pointer to an open file
+ * return   - same as utf8_validate_mt with the default executor over the whole file*/
+int utf8_file_validate(const utf8_file *file, size_t *error_offset);
+
+/* `file`   - pointer to an open file
+ * return   - same as utf8_view_substr over the whole file*/
+utf8_view utf8_file_substr(const utf8_file *file, size_t off, size_t count);
+
+/* Columns of strings are stored Arrow-style: the octets of all the strings follow each other in one buffer and
+ * `n` + 1 non-decreasing offsets split it, string `i` is [data + offsets[i], data + offsets[i + 1]).
+ * None of the strings has to be \0 terminated*/
+
+/* `data`   - pointer to the octets of the strings
+ * `offsets` - pointer to `n` + 1 offsets into `data`
+ * `n`      - number of strings
+ * `counts` - pointer to `n` elements that receive the number of code points of every string
+ * return   - UTF8_OK or UTF8_EINVAL*/
+int utf8_distance_batch(const char *data, const size_t *offsets, size_t n, size_t *counts);
+
+/* `data`   - pointer to the octets of the strings
+ * `offsets` - pointer to `n` + 1 offsets into `data`
+ * `n`      - number of strings
+ * `error_offsets` - pointer to `n` elements that receive the offset of the first ill-formed sequence of every
+ *     string, relative to the string, or utf8_npos for valid ones. Can be NULL
+ * return   - number of ill-formed strings or utf8_npos if arguments are invalid, errno is set to UTF8_EINVAL*/
+size_t utf8_validate_batch(const char *data, const size_t *offsets, size_t n, size_t *error_offsets);
+
+/* `data`   - pointer to the octets of the strings
+ * `offsets` - pointer to `n` + 1 offsets into `data`
+ * `n`      - number of strings
+ * `off`    - number of code points to skip in every string, strings that have less become empty
+ * `count`  - number of code points to take from every string, utf8_npos or more than left means the rest
+ * `out_data` - pointer to a buffer for the octets of the substrings, offsets[n] - offsets[0] octets are enough
+ * `out_offsets` - pointer to `n` + 1 elements that receive the offsets of the substrings in `out_data`
+ * return   - UTF8_OK or UTF8_EINVAL*/
+int utf8_substr_batch(const char *data, const size_t *offsets, size_t n, size_t off, size_t count,
+                      char *out_data, size_t *out_offsets);
+
+/* _into variants write into caller memory instead of allocating. Like snprintf they write at most
+ * `dst_cap` - 1 octets and a \0, cutting the result short on a code point boundary if it doesn't fit,
+ * and return the number of octets the whole result takes (without \0). The result fits if that's less
+ * than `dst_cap`, otherwise a buffer of that plus one octet is enough for a retry. `dst` can be NULL if
+ * `dst_cap` is 0 to only get the size. On error utf8_npos is returned and errno is set to UTF8_EINVAL
+ * or UTF8_ERANGE, just like for the allocating variants*/
+
+/* `dst`    - pointer to a buffer for the result
+ * `dst_cap` - number of octets in `dst`, including the one for \0
+ * return   - same as utf8_substr_n would write to `out_len`*/
+size_t utf8_substr_into(char *dst, size_t dst_cap, const char *str, size_t len, size_t off, size_t count);
+
+/* return   - same as utf8_join_n would write to `out_len`, see utf8_substr_into for `dst` and `dst_cap`*/
+size_t utf8_join_into(char *dst, size_t dst_cap, const char *str, size_t len, const char *joiner, size_t joiner_len);
+
+/* return   - same as utf8_repeat_n would write to `out_len`, see utf8_substr_into for `dst` and `dst_cap`*/
+size_t utf8_repeat_into(char *dst, size_t dst_cap, const char *str, size_t len, size_t n);
+
+/* return   - same as utf8_strcat_n would write to `out_len`, see utf8_substr_into for `dst` and `dst_cap`*/
+size_t utf8_strcat_into(char *dst, size_t dst_cap, const char *a, size_t len_a, const char *b, size_t len_b);
+
+/* `n_str`  - number of input strings, 0 gives an empty result
+ * `... `   - `n_str` pairs of a pointer to a string and its number of octets, as for utf8_vstrcat_n
+ * return   - same as utf8_vstrcat_n would write to `out_len`, see utf8_substr_into for `dst` and `dst_cap`*/
+size_t utf8_vstrcat_into(char *dst, size_t dst_cap, size_t n_str, ...);
+
+/* return   - same as utf8_to_str_n would write to `out_len`, see utf8_substr_into for `dst` and `dst_cap`*/
+size_t utf8_to_str_into(char *dst, size_t dst_cap, char *const *arr, const size_t *lens, size_t n);
+
+/* Canonical normalization (UAX #15) and full case folding. Ill-formed octets are kept as they are and nothing
+ * composes with them. Input that's already in the requested form is recognized by a vector scan and quick check
+ * properties, so utf8_is_* return without copying anything for it*/
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * return   - 1 if `str` is in Normalization Form C, 0 otherwise or if `str` is NULL, errno is set to UTF8_EINVAL then*/
+int utf8_is_nfc(const char *str, size_t len);
+
+/* return   - same as utf8_is_nfc, but for Normalization Form D*/
+int utf8_is_nfd(const char *str, size_t len);
+
+/* return   - same as utf8_is_nfc, but checks that full case folding leaves `str` as it is*/
+int utf8_is_casefolded(const char *str, size_t len);
+
+/* `str`    - pointer to a string, must be \0 terminated
+ * return   - pointer to the beginning of DYNAMICALLY allocated Normalization Form C of `str`
+ *     or NULL if allocation fails. MUST BE FREED MANUALLY*/
+char *utf8_normalize_nfc(const char *str);
+
+/* `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `out_len` - pointer to a variable that receives the number of octets in the result (without \0) or NULL
+ * return   - same as utf8_normalize_nfc*/
+char *utf8_normalize_nfc_n(const char *str, size_t len, size_t *out_len);
+
+/* `alloc`  - pointer to an allocator to use or NULL for malloc
+ * return   - same as utf8_normalize_nfc_n, but allocated with `alloc`. MUST BE FREED with `alloc`*/
+char *utf8_normalize_nfc_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len);
+
+/* return   - same as utf8_normalize_nfc_n would write to `out_len`, see utf8_substr_into for `dst` and `dst_cap`*/
+size_t utf8_normalize_nfc_into(char *dst, size_t dst_cap, const char *str, size_t len);
+
+/* `builder` - pointer to an initialized builder
+ * `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * return   - UTF8_OK, UTF8_ERANGE if the result is too big to fit into memory or UTF8_ENOMEM if allocation fails,
+ *     in which case the builder stays unchanged. Appends the same string utf8_normalize_nfc_n creates*/
+int utf8_builder_append_nfc(utf8_builder *builder, const char *str, size_t len);
+
+/* Same as the utf8_normalize_nfc functions, but for Normalization Form D*/
+char *utf8_normalize_nfd(const char *str);
+char *utf8_normalize_nfd_n(const char *str, size_t len, size_t *out_len);
+char *utf8_normalize_nfd_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len);
+size_t utf8_normalize_nfd_into(char *dst, size_t dst_cap, const char *str, size_t len);
+int utf8_builder_append_nfd(utf8_builder *builder, const char *str, size_t len);
+
+/* Same as the utf8_normalize_nfc functions, but map every code point to its full case folding (CaseFolding.txt
+ * statuses C and F). The result isn't normalized, compare NFC of case folded strings for caseless matching*/
+char *utf8_casefold(const char *str);
+char *utf8_casefold_n(const char *str, size_t len, size_t *out_len);
+char *utf8_casefold_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len);
+size_t utf8_casefold_into(char *dst, size_t dst_cap, const char *str, size_t len);
+int utf8_builder_append_casefold(utf8_builder *builder, const char *str, size_t len);
+
+/* `str`    - pointer to a string to search in, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * `needle` - pointer to a string to look for, doesn't have to be \0 terminated
+ * `needle_len` - number of octets in `needle`, an empty needle is found at the beginning of `str`
+ * `out_cp_off` - pointer to a variable that receives the number of code points before the match or NULL.
+ *     They're counted in the same pass as the search
+ * return   - pointer to the first occurrence of `needle` in `str` that starts and ends on code point boundaries
+ *     or NULL if there's none. Needles that start with a continuation octet are never found*/
+char *utf8_find(const char *str, size_t len, const char *needle, size_t needle_len, size_t *out_cp_off);
+
+/* return   - same as utf8_find, but the last occurrence. An empty needle is found at the end of `str`.
+ *     Code points before the match are counted by a separate pass, only if `out_cp_off` isn't NULL*/
+char *utf8_rfind(const char *str, size_t len, const char *needle, size_t needle_len, size_t *out_cp_off);
+
+/* `cp`     - code point to look for
+ * return   - same as utf8_find, or NULL if `cp` is a surrogate or above U+10FFFF, errno is set to UTF8_EILSEQ then*/
+char *utf8_find_cp(const char *str, size_t len, utf8_char32 cp, size_t *out_cp_off);
+
+/* Lossy repair of ill-formed utf-8: every maximal subpart of an ill-formed sequence, the longest prefix of
+ * a well-formed sequence or a single octet that can't start one, becomes U+FFFD, as recommended in chapter 3.9
+ * of the Unicode standard. Well-formed parts are copied as they are, valid input is recognized by the vector
+ * validation and isn't written to*/
+
+/* `str`    - pointer to a string to sanitize in place, doesn't have to be \0 terminated, MUST NOT BE READ-ONLY
+ * `len`    - number of octets in `str`
+ * `cap`    - number of octets `str` can hold, at least `len`. Each replacement takes 3 octets, so the result can
+ *     be up to 3 times as long as `str`
+ * return   - number of octets in the result, \0 isn't added. If it's more than `cap`, `str` is left as it is and
+ *     utf8_sanitize_into or utf8_builder_append_sanitized can write the result elsewhere. utf8_npos on error,
+ *     errno is set to UTF8_EINVAL or UTF8_ERANGE then*/
+size_t utf8_sanitize(char *str, size_t len, size_t cap);
+
+/* return   - same as utf8_sanitize, see utf8_substr_into for `dst` and `dst_cap`. `dst` must not overlap `str`*/
+size_t utf8_sanitize_into(char *dst, size_t dst_cap, const char *str, size_t len);
+
+/* `builder` - pointer to an initialized builder
+ * `str`    - pointer to a string, doesn't have to be \0 terminated
+ * `len`    - number of octets in `str`
+ * return   - UTF8_OK, UTF8_ERANGE if the result is too big to fit into memory or UTF8_ENOMEM if allocation fails,
+ *     in which case the builder stays unchanged. Appends the same string utf8_sanitize leaves in `str`*/
+int utf8_builder_append_sanitized(utf8_builder *builder, const char *str, size_t len);
+
+/* Counters of one public function in the calling thread, see utf8_stats_snapshot*/
+typedef struct utf8_stat {
+    const char *name;       /* Name of the function, e.g. "utf8_substr"*/
+    size_t calls;           /* Number of calls, including the ones made by other utf8c functions*/
+    size_t octets;          /* Octets of input passed in or measured*/
+    size_t strlens;         /* Number of \0 terminated arguments measured with strlen*/
+    size_t cps;             /* Code points counted, decoded or encoded*/
+    size_t fast;            /* Inputs handled by a fast path alone, e.g. found normalized by the quick check*/
+    size_t slow;            /* Inputs or chunks of them that took the slow path, e.g. Two-Way search*/
+    size_t allocs;          /* Number of allocations and reallocations*/
+    size_t alloc_octets;    /* Octets requested by them*/
+} utf8_stat;
+
+/* Functions count their calls only if the library is built with UTF8C_STATS (the CMake option of the same name),
+ * otherwise instrumentation is compiled out. Counters are kept per thread, allocations and the other counters
+ * go to the public function that was entered last
+ * `dst`    - pointer to an array that receives the counters of the functions the calling thread called since
+ *     the last utf8_stats_reset, in the order of this header
+ * `cap`    - number of entries `dst` can hold, the rest isn't written
+ * return   - number of such functions, 0 if the library was built without UTF8C_STATS*/
+size_t utf8_stats_snapshot(utf8_stat *dst, size_t cap);
+
+/* Zeroes the counters of the calling thread*/
+void utf8_stats_reset(void);
+
 #endif /* UTF8C_H*/
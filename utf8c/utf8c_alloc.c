@@ -0,0 +1,195 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_alloc.h"
+#include "utf8c_stats.h"
+
+/* Arena blocks are aligned to the strictest of these*/
+typedef union utf8c_max_align {
+    void *p;
+    double d;
+    long l;
+    size_t s;
+} utf8c_max_align;
+
+#define ALIGN_UP(n) (((n) + sizeof(utf8c_max_align) - 1) / sizeof(utf8c_max_align) * sizeof(utf8c_max_align))
+
+struct utf8_arena_block {
+    struct utf8_arena_block *next;
+    size_t size;    /* Number of usable octets after the header*/
+    size_t used;    /* Number of octets taken by allocations*/
+    size_t last;    /* Offset of the last allocation, so it can grow or shrink in place*/
+};
+
+#define BLOCK_HEADER ALIGN_UP(sizeof(struct utf8_arena_block))
+#define BLOCK_DATA(block) ((char *) (block) + BLOCK_HEADER)
+
+void *utf8c_alloc(const utf8_allocator *alloc, size_t size) {
+    UTF8C_STAT_ADD(allocs, 1);
+    UTF8C_STAT_ADD(alloc_octets, size);
+    return (alloc != NULL)
+           ? alloc->alloc(alloc->ctx, size)
+           : malloc(size);
+}
+
+void *utf8c_realloc(const utf8_allocator *alloc, void *ptr, size_t old_size, size_t new_size) {
+    UTF8C_STAT_ADD(allocs, 1);
+    UTF8C_STAT_ADD(alloc_octets, new_size);
+    return (alloc != NULL)
+           ? alloc->resize(alloc->ctx, ptr, old_size, new_size)
+           : realloc(ptr, new_size);
+}
+
+void utf8c_free(const utf8_allocator *alloc, void *ptr) {
+    if (alloc != NULL) {
+        alloc->release(alloc->ctx, ptr);
+    } else {
+        free(ptr);
+    }
+}
+
+static void *arena_alloc(void *ctx, size_t size) {
+    utf8_arena *arena;
+    struct utf8_arena_block *block, **spare;
+
+    arena = (utf8_arena *) ctx;
+    if (size > (size_t) -1 - BLOCK_HEADER - sizeof(utf8c_max_align)) {
+        return NULL;
+    }
+    size = ALIGN_UP(size);
+
+    block = arena->blocks;
+    if (block == NULL || block->size - block->used < size) {
+        /* Reuse a block freed by utf8_arena_reset or get a new one*/
+        for (spare = &arena->spare; *spare != NULL && (*spare)->size < size; spare = &(*spare)->next);
+        if (*spare != NULL) {
+            block = *spare;
+            *spare = block->next;
+        } else {
+            block = (struct utf8_arena_block *) malloc(BLOCK_HEADER + ((size > arena->block_size)
+                                                                       ? size
+                                                                       : arena->block_size));
+            if (block == NULL) {
+                return NULL;
+            }
+            block->size = (size > arena->block_size) ? size : arena->block_size;
+        }
+        block->used = 0;
+        block->next = arena->blocks;
+        arena->blocks = block;
+    }
+
+    block->last = block->used;
+    block->used += size;
+    return BLOCK_DATA(block) + block->last;
+}
+
+static void *arena_resize(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    utf8_arena *arena;
+    struct utf8_arena_block *block;
+    void *new_ptr;
+
+    arena = (utf8_arena *) ctx;
+    if (ptr == NULL) {
+        return arena_alloc(ctx, new_size);
+    }
+
+    /* The last allocation can be resized in place*/
+    block = arena->blocks;
+    if (ptr == BLOCK_DATA(block) + block->last && block->size - block->last >= new_size) {
+        block->used = block->last + ALIGN_UP(new_size);
+        return ptr;
+    }
+
+    new_ptr = arena_alloc(ctx, new_size);
+    if (new_ptr != NULL) {
+        memcpy(new_ptr, ptr, (old_size < new_size) ? old_size : new_size);
+    }
+    return new_ptr;
+}
+
+static void arena_release(void *ctx, void *ptr) {
+    utf8_arena *arena;
+    struct utf8_arena_block *block;
+
+    /* Memory is given back all at once by utf8_arena_reset, only the last allocation can be undone*/
+    arena = (utf8_arena *) ctx;
+    block = arena->blocks;
+    if (block != NULL && ptr == BLOCK_DATA(block) + block->last) {
+        block->used = block->last;
+    }
+}
+
+void utf8_arena_init(utf8_arena *arena, size_t block_size) {
+    UTF8C_STAT_CALL(utf8_arena_init, 0);
+    if (arena == NULL) {
+        errno = UTF8_EINVAL;
+        return;
+    }
+
+    arena->allocator.alloc = arena_alloc;
+    arena->allocator.resize = arena_resize;
+    arena->allocator.release = arena_release;
+    arena->allocator.ctx = arena;
+    arena->block_size = ALIGN_UP((block_size != 0) ? block_size : UTF8_ARENA_BLOCK);
+    arena->blocks = NULL;
+    arena->spare = NULL;
+}
+
+void utf8_arena_reset(utf8_arena *arena) {
+    struct utf8_arena_block *block;
+
+    UTF8C_STAT_CALL(utf8_arena_reset, 0);
+    if (arena == NULL) {
+        errno = UTF8_EINVAL;
+        return;
+    }
+
+    while (arena->blocks != NULL) {
+        block = arena->blocks;
+        arena->blocks = block->next;
+        block->next = arena->spare;
+        arena->spare = block;
+    }
+}
+
+void utf8_arena_release(utf8_arena *arena) {
+    struct utf8_arena_block *block;
+
+    UTF8C_STAT_CALL(utf8_arena_release, 0);
+    if (arena == NULL) {
+        errno = UTF8_EINVAL;
+        return;
+    }
+
+    utf8_arena_reset(arena);
+    while (arena->spare != NULL) {
+        block = arena->spare;
+        arena->spare = block->next;
+        free(block);
+    }
+}
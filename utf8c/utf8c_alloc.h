@@ -0,0 +1,37 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Internal allocation helpers shared by utf8c translation units. Not part of the public API.*/
+#ifndef UTF8C_ALLOC_H
+#define UTF8C_ALLOC_H
+
+#include "utf8c.h"
+
+/* `alloc`  - allocator to use or NULL for malloc/realloc/free
+ * Same as their standard counterparts, but don't touch errno*/
+void *utf8c_alloc(const utf8_allocator *alloc, size_t size);
+void *utf8c_realloc(const utf8_allocator *alloc, void *ptr, size_t old_size, size_t new_size);
+void utf8c_free(const utf8_allocator *alloc, void *ptr);
+
+#endif /* UTF8C_ALLOC_H*/
@@ -0,0 +1,141 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Functions over columns of strings stored Arrow-style: one buffer with the octets of all the strings and
+ * an array of offsets into it. Work is done on the whole column at once wherever that's possible*/
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_stats.h"
+
+/* Strings as long as this are handed to the SIMD kernels, shorter ones are scanned inline*/
+#define LONG_STRING 64
+
+int utf8_distance_batch(const char *data, const size_t *offsets, size_t n, size_t *counts) {
+    UTF8C_STAT_CALL(utf8_distance_batch, (offsets != NULL && n != 0) ? offsets[n] - offsets[0] : 0);
+    if (offsets == NULL || (data == NULL && n != 0) || (counts == NULL && n != 0)) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+    if (n != 0) {
+        utf8c_count_leads_batch(data, offsets, n, counts);
+    }
+    return UTF8_OK;
+}
+
+size_t utf8_validate_batch(const char *data, const size_t *offsets, size_t n, size_t *error_offsets) {
+    size_t i, b, e, end, err, off, n_invalid;
+
+    UTF8C_STAT_CALL(utf8_validate_batch, (offsets != NULL && n != 0) ? offsets[n] - offsets[0] : 0);
+    if (offsets == NULL || (data == NULL && n != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    /* The whole column is validated at once. Every string whose octets lie before the first error is valid
+     * as well, unless a code point crosses its boundary: then the octet at the boundary is a continuation octet.
+     * Only strings like that, and the one holding the error, are validated one by one, after which the column
+     * validation resumes from the next string*/
+    n_invalid = 0;
+    end = (n != 0) ? offsets[n] : 0;
+    err = (n != 0) ? offsets[0] + utf8c_validate(data + offsets[0], end - offsets[0]) : 0;
+    for (i = 0; i < n; i++) {
+        b = offsets[i];
+        e = offsets[i + 1];
+        if (e <= err && (b == e || UTF8C_IS_LEAD(data[b])) && (e == end || UTF8C_IS_LEAD(data[e]))) {
+            off = utf8_npos;
+        } else {
+            off = utf8c_validate(data + b, e - b);
+            off = (off != e - b) ? off : utf8_npos;
+            if (e > err) {
+                err = e + utf8c_validate(data + e, end - e);
+            }
+        }
+        n_invalid += (off != utf8_npos);
+        if (error_offsets != NULL) {
+            error_offsets[i] = off;
+        }
+    }
+    return n_invalid;
+}
+
+/* `s`      - pointer to a string
+ * `len`    - number of octets in `s`
+ * `n`      - number of code points to skip
+ * return   - same as utf8_advance, but an offset in `s` and `len` if `s` has less than `n` code points*/
+static size_t skip_cps(const char *s, size_t len, size_t n) {
+    size_t i;
+    const char *it;
+
+    if (len >= LONG_STRING) {
+        it = utf8_advance(s, n, s + len);
+        return (it != NULL) ? (size_t) (it - s) : len;
+    }
+    /* `n` wraps around at the lead octet we look for. Branching on every octet's kind instead mispredicts
+     * all the time on mixed text*/
+    for (i = 0; i < len; i++) {
+        n -= (size_t) UTF8C_IS_LEAD(s[i]);
+        if (n == (size_t) -1) {
+            return i;
+        }
+    }
+    return len;
+}
+
+int utf8_substr_batch(const char *data, const size_t *offsets, size_t n, size_t off, size_t count,
+                      char *out_data, size_t *out_offsets) {
+    size_t i, b, e, end, ascii_end, sb, se, out_len;
+
+    UTF8C_STAT_CALL(utf8_substr_batch, (offsets != NULL && n != 0) ? offsets[n] - offsets[0] : 0);
+    if (offsets == NULL || out_offsets == NULL || (n != 0 && (data == NULL || out_data == NULL))) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    /* Octets of ASCII strings are code points, so those are sliced by arithmetic alone. ASCII runs are found
+     * in bulk across string boundaries, a scan starts again once a string goes past the last one*/
+    out_len = 0;
+    out_offsets[0] = 0;
+    end = (n != 0) ? offsets[n] : 0;
+    ascii_end = 0;
+    for (i = 0; i < n; i++) {
+        b = offsets[i];
+        e = offsets[i + 1];
+        if (e > ascii_end && b >= ascii_end) {
+            ascii_end = b + utf8c_skip_ascii(data + b, end - b);
+        }
+        if (e <= ascii_end) {
+            sb = (off < e - b) ? b + off : e;
+            se = (count < e - sb) ? sb + count : e;
+        } else {
+            sb = b + skip_cps(data + b, e - b, off);
+            se = (count == utf8_npos) ? e : sb + skip_cps(data + sb, e - sb, count);
+        }
+        memcpy(out_data + out_len, data + sb, se - sb);
+        out_len += se - sb;
+        out_offsets[i + 1] = out_len;
+    }
+    return UTF8_OK;
+}
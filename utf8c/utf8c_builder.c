@@ -0,0 +1,236 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_alloc.h"
+#include "utf8c_stats.h"
+
+void utf8_builder_init(utf8_builder *builder, const utf8_allocator *alloc) {
+    UTF8C_STAT_CALL(utf8_builder_init, 0);
+    if (builder == NULL) {
+        errno = UTF8_EINVAL;
+        return;
+    }
+
+    builder->alloc = alloc;
+    builder->data = NULL;
+    builder->len = 0;
+    builder->n_cps = 0;
+    builder->cap = 0;
+}
+
+int utf8_builder_reserve(utf8_builder *builder, size_t n) {
+    size_t cap;
+    char *data;
+
+    UTF8C_STAT_CALL(utf8_builder_reserve, 0);
+    if (builder == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    if (n > (size_t) -1 - builder->len - 1) {
+        errno = UTF8_ERANGE;
+        return UTF8_ERANGE;
+    }
+
+    if (builder->cap - builder->len > n) { /* Enough room for `n` octets and \0*/
+        return UTF8_OK;
+    }
+
+    /* Grow geometrically, so appending octet by octet takes amortized constant time*/
+    cap = (builder->cap > UTF8_BUILDER_MIN_CAP / 2) ? builder->cap : UTF8_BUILDER_MIN_CAP / 2;
+    cap = (cap <= (size_t) -1 / 2) ? cap * 2 : (size_t) -1;
+    if (cap < builder->len + n + 1) {
+        cap = builder->len + n + 1;
+    }
+
+    data = (char *) utf8c_realloc(builder->alloc, builder->data, sizeof(char) * builder->cap, sizeof(char) * cap);
+    if (data == NULL) {
+        errno = UTF8_ENOMEM;
+        return UTF8_ENOMEM;
+    }
+    if (builder->data == NULL) {
+        data[0] = '\0';
+    }
+    builder->data = data;
+    builder->cap = cap;
+    return UTF8_OK;
+}
+
+int utf8_builder_append(utf8_builder *builder, const char *str, size_t len) {
+    int res;
+
+    UTF8C_STAT_CALL(utf8_builder_append, len);
+    if (builder == NULL || str == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    res = utf8_builder_reserve(builder, len);
+    if (res != UTF8_OK) {
+        return res;
+    }
+
+    memcpy(&builder->data[builder->len], str, sizeof(char) * len);
+    builder->len += len;
+    builder->data[builder->len] = '\0';
+    builder->n_cps += utf8_distance(str, &str[len]);
+    return UTF8_OK;
+}
+
+int utf8_builder_append_cp(utf8_builder *builder, utf8_char32 cp) {
+    int res;
+
+    UTF8C_STAT_CALL(utf8_builder_append_cp, 0);
+    if (builder == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        errno = UTF8_EILSEQ;
+        return UTF8_EILSEQ;
+    }
+
+    res = utf8_builder_reserve(builder, UTF8C_CP_MAX);
+    if (res != UTF8_OK) {
+        return res;
+    }
+
+    builder->len += utf8c_encode(cp, &builder->data[builder->len]);
+    builder->data[builder->len] = '\0';
+    builder->n_cps++;
+    UTF8C_STAT_ADD(cps, 1);
+    return UTF8_OK;
+}
+
+int utf8_builder_append_repeat(utf8_builder *builder, const char *str, size_t len, size_t n) {
+    size_t total, copied, chunk;
+    char *dst;
+    int res;
+
+    UTF8C_STAT_CALL(utf8_builder_append_repeat, len);
+    if (builder == NULL || str == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    if (n == 0 || len == 0) {
+        return UTF8_OK;
+    }
+
+    if (len > (size_t) -1 / n) {
+        errno = UTF8_ERANGE;
+        return UTF8_ERANGE;
+    }
+
+    total = len * n;
+    res = utf8_builder_reserve(builder, total);
+    if (res != UTF8_OK) {
+        return res;
+    }
+
+    /* Copy `str` once, then keep doubling what's already copied*/
+    dst = &builder->data[builder->len];
+    memcpy(dst, str, sizeof(char) * len);
+    for (copied = len; copied < total; copied += chunk) {
+        chunk = (copied < total - copied) ? copied : total - copied;
+        memcpy(dst + copied, dst, sizeof(char) * chunk);
+    }
+
+    builder->len += total;
+    builder->data[builder->len] = '\0';
+    builder->n_cps += utf8_distance(str, &str[len]) * n;
+    return UTF8_OK;
+}
+
+int utf8_builder_append_join(utf8_builder *builder, const char *str, size_t len, const char *joiner, size_t joiner_len) {
+    size_t dist, n_joiners;
+    int res;
+
+    UTF8C_STAT_CALL(utf8_builder_append_join, len);
+    if (builder == NULL || str == NULL || joiner == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    dist = utf8_distance(str, &str[len]);
+    /* Joiners go before every code point but the first, continuation octets at the beginning aren't one*/
+    n_joiners = (len != 0) ? dist - UTF8C_IS_LEAD(str[0]) : 0;
+    if (n_joiners == 0 || joiner_len == 0) { /* Nothing to put joiner between*/
+        return utf8_builder_append(builder, str, len);
+    }
+
+    if (joiner_len > ((size_t) -1 - len) / n_joiners) {
+        errno = UTF8_ERANGE;
+        return UTF8_ERANGE;
+    }
+
+    res = utf8_builder_reserve(builder, len + joiner_len * n_joiners);
+    if (res != UTF8_OK) {
+        return res;
+    }
+
+    builder->len += utf8c_join(str, len, joiner, joiner_len, &builder->data[builder->len]);
+    builder->data[builder->len] = '\0';
+    builder->n_cps += dist + utf8_distance(joiner, &joiner[joiner_len]) * n_joiners;
+    return UTF8_OK;
+}
+
+char *utf8_builder_finish(utf8_builder *builder, size_t *out_len) {
+    char *data;
+
+    UTF8C_STAT_CALL(utf8_builder_finish, 0);
+    if (builder == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    if (builder->data == NULL && utf8_builder_reserve(builder, 0) != UTF8_OK) { /* Nothing appended, still return ""*/
+        return NULL;
+    }
+
+    data = builder->data;
+    if (out_len != NULL) {
+        *out_len = builder->len;
+    }
+    utf8_builder_init(builder, builder->alloc);
+    return data;
+}
+
+void utf8_builder_free(utf8_builder *builder) {
+    UTF8C_STAT_CALL(utf8_builder_free, 0);
+    if (builder == NULL) {
+        errno = UTF8_EINVAL;
+        return;
+    }
+
+    if (builder->data != NULL) {
+        utf8c_free(builder->alloc, builder->data);
+    }
+    utf8_builder_init(builder, builder->alloc);
+}
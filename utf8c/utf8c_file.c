@@ -0,0 +1,263 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Read-only files mapped into memory, so that large files are processed in place instead of being read into
+ * a \0 terminated copy*/
+#if defined(__unix__) || defined(__APPLE__)
+#define UTF8C_MMAP 1
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+#if !defined(_FILE_OFFSET_BITS)
+#define _FILE_OFFSET_BITS 64
+#endif
+#endif
+
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_stats.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(UTF8C_MMAP)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+/* Empty files aren't mapped, they all share this*/
+static const char empty[1] = "";
+
+static void set_empty(utf8_file *file) {
+    file->data = empty;
+    file->len = 0;
+}
+
+#if defined(_WIN32)
+static int open_file(utf8_file *file, const char *path) {
+    HANDLE handle, mapping;
+    LARGE_INTEGER size;
+    const void *data;
+    DWORD error;
+
+    handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (handle == INVALID_HANDLE_VALUE) {
+        error = GetLastError();
+        return (error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND) ? ENOENT
+               : (error == ERROR_ACCESS_DENIED) ? EACCES : EIO;
+    }
+    if (!GetFileSizeEx(handle, &size)) {
+        CloseHandle(handle);
+        return EIO;
+    }
+    if ((LONGLONG) (size_t) size.QuadPart != size.QuadPart) {
+        CloseHandle(handle);
+        return UTF8_ERANGE;
+    }
+    if (size.QuadPart == 0) {
+        CloseHandle(handle);
+        set_empty(file);
+        return UTF8_OK;
+    }
+
+    /* The view keeps the file mapped after both handles are closed*/
+    mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);
+    if (mapping == NULL) {
+        return (GetLastError() == ERROR_NOT_ENOUGH_MEMORY) ? UTF8_ENOMEM : EIO;
+    }
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == NULL) {
+        return (GetLastError() == ERROR_NOT_ENOUGH_MEMORY) ? UTF8_ENOMEM : EIO;
+    }
+
+    file->data = (const char *) data;
+    file->len = (size_t) size.QuadPart;
+    return UTF8_OK;
+}
+
+static void close_file(utf8_file *file) {
+    UnmapViewOfFile(file->data);
+}
+#elif defined(UTF8C_MMAP)
+static int open_file(utf8_file *file, const char *path) {
+    struct stat st;
+    void *data;
+    int fd, error;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return errno;
+    }
+    if (fstat(fd, &st) != 0) {
+        error = errno;
+        close(fd);
+        return error;
+    }
+    if ((off_t) (size_t) st.st_size != st.st_size) {
+        close(fd);
+        return UTF8_ERANGE;
+    }
+    if (st.st_size == 0) {
+        close(fd);
+        set_empty(file);
+        return UTF8_OK;
+    }
+
+    /* The mapping stays valid after the descriptor is closed*/
+    data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    error = errno;
+    close(fd);
+    if (data == MAP_FAILED) {
+        return error;
+    }
+    /* Only a hint: pages are read ahead and dropped behind, as most of the API scans the file once*/
+    posix_madvise(data, (size_t) st.st_size, POSIX_MADV_SEQUENTIAL);
+
+    file->data = (const char *) data;
+    file->len = (size_t) st.st_size;
+    return UTF8_OK;
+}
+
+static void close_file(utf8_file *file) {
+    munmap((void *) file->data, file->len);
+}
+#else
+/* No mapping on this platform, the file is read into memory instead*/
+static int open_file(utf8_file *file, const char *path) {
+    FILE *f;
+    long size;
+    char *data;
+
+    f = fopen(path, "rb");
+    if (f == NULL) {
+        return (errno != 0) ? errno : UTF8_EINVAL;
+    }
+    if (fseek(f, 0, SEEK_END) != 0 || (size = ftell(f)) < 0 || fseek(f, 0, SEEK_SET) != 0) {
+        fclose(f);
+        return UTF8_EINVAL;
+    }
+    if (size == 0) {
+        fclose(f);
+        set_empty(file);
+        return UTF8_OK;
+    }
+
+    UTF8C_STAT_ADD(allocs, 1);
+    UTF8C_STAT_ADD(alloc_octets, size);
+    data = (char *) malloc((size_t) size);
+    if (data == NULL) {
+        fclose(f);
+        return UTF8_ENOMEM;
+    }
+    if (fread(data, 1, (size_t) size, f) != (size_t) size) {
+        free(data);
+        fclose(f);
+        return UTF8_EINVAL;
+    }
+    fclose(f);
+
+    file->data = data;
+    file->len = (size_t) size;
+    return UTF8_OK;
+}
+
+static void close_file(utf8_file *file) {
+    free((void *) file->data);
+}
+#endif
+
+int utf8_file_open(utf8_file *file, const char *path) {
+    int error;
+
+    UTF8C_STAT_CALL(utf8_file_open, 0);
+    if (file == NULL || path == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    error = open_file(file, path);
+    if (error != UTF8_OK) {
+        file->data = NULL;
+        file->len = 0;
+        errno = error;
+    }
+    return error;
+}
+
+void utf8_file_close(utf8_file *file) {
+    UTF8C_STAT_CALL(utf8_file_close, 0);
+    if (file == NULL || file->data == NULL) {
+        return;
+    }
+    if (file->data != empty) {
+        close_file(file);
+    }
+    file->data = NULL;
+    file->len = 0;
+}
+
+utf8_view utf8_file_view(const utf8_file *file) {
+    utf8_view view;
+
+    UTF8C_STAT_CALL(utf8_file_view, 0);
+    if (file == NULL || file->data == NULL) {
+        errno = UTF8_EINVAL;
+        view.ptr = NULL;
+        view.len = 0;
+        return view;
+    }
+    view.ptr = file->data;
+    view.len = file->len;
+    return view;
+}
+
+size_t utf8_file_distance(const utf8_file *file) {
+    UTF8C_STAT_CALL(utf8_file_distance, 0);
+    if (file == NULL || file->data == NULL) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    return utf8_distance_mt(NULL, file->data, file->data + file->len);
+}
+
+int utf8_file_validate(const utf8_file *file, size_t *error_offset) {
+    UTF8C_STAT_CALL(utf8_file_validate, 0);
+    if (file == NULL || file->data == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+    return utf8_validate_mt(NULL, file->data, file->data + file->len, error_offset);
+}
+
+utf8_view utf8_file_substr(const utf8_file *file, size_t off, size_t count) {
+    UTF8C_STAT_CALL(utf8_file_substr, 0);
+    return utf8_view_substr(utf8_file_view(file), off, count);
+}
@@ -0,0 +1,223 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Substring search. Short needles are found by the vector candidate filter of the find kernel, long ones by
+ * the Two-Way algorithm of Crochemore and Perrin, which takes linear time whatever the input. The haystack is
+ * searched in windows, so that code points of a window are counted while it's still in cache. Long needles are
+ * searched for backward from the end of the haystack by utf8_rfind*/
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_stats.h"
+
+/* Needles of this many octets and more are searched for with Two-Way*/
+#define UTF8C_FIND_TWO_WAY 64
+
+/* Number of match positions searched at once*/
+#define UTF8C_FIND_WINDOW 16384
+
+typedef struct find_needle {
+    const char *str;
+    size_t len;
+    size_t suffix;  /* Critical factorization of a Two-Way needle, can be 0*/
+    size_t period;
+} find_needle;
+
+#define UTF8C_TW(name) name
+#define UTF8C_TW_AT(p, i) ((p)[i])
+#define UTF8C_TW_EQUAL(p, a, b, n) (memcmp((p) + (a), (p) + (b), (n)) == 0)
+#include "utf8c_two_way.inc"
+#undef UTF8C_TW
+#undef UTF8C_TW_AT
+#undef UTF8C_TW_EQUAL
+
+#define UTF8C_TW(name) name##_rev
+#define UTF8C_TW_AT(p, i) ((p)[-(ptrdiff_t) (i)])
+#define UTF8C_TW_EQUAL(p, a, b, n) (memcmp((p) + 1 - (a) - (n), (p) + 1 - (b) - (n), (n)) == 0)
+#include "utf8c_two_way.inc"
+#undef UTF8C_TW
+#undef UTF8C_TW_AT
+#undef UTF8C_TW_EQUAL
+
+/* `backward` - whether the needle is searched for with two_way_rev, then it's read from its last octet*/
+static void needle_init(find_needle *needle, const char *str, size_t len, int backward) {
+    needle->str = backward ? str + len - 1 : str;
+    needle->len = len;
+    needle->suffix = 0;
+    needle->period = 0;
+    if (len >= UTF8C_FIND_TWO_WAY) {
+        needle->suffix = backward
+                         ? critical_factorization_rev((const unsigned char *) needle->str, len, &needle->period)
+                         : critical_factorization((const unsigned char *) str, len, &needle->period);
+    }
+    UTF8C_STAT_ADD(fast, len < UTF8C_FIND_TWO_WAY);
+    UTF8C_STAT_ADD(slow, len >= UTF8C_FIND_TWO_WAY);
+}
+
+/* return   - offset of the first occurrence of `needle` in `s` that ends on a code point boundary of `str`,
+ *     or `len` if there's none. `s` lies within [str, str + str_len)*/
+static size_t search(const find_needle *needle, const char *str, size_t str_len, const char *s, size_t len) {
+    size_t off, at, end;
+
+    at = 0;
+    while (at < len) {
+        off = (needle->len >= UTF8C_FIND_TWO_WAY)
+              ? two_way(needle, s + at, len - at)
+              : utf8c_find(s + at, len - at, needle->str, needle->len);
+        if (off == len - at) {
+            break;
+        }
+        /* Matches start on a lead octet like the needle does, a continuation octet right after one
+         * means the last code point of the needle is a prefix of a longer one*/
+        end = (size_t) (s - str) + at + off + needle->len;
+        if (end == str_len || !UTF8C_IS_CONT(str[end])) {
+            return at + off;
+        }
+        at += off + 1;
+    }
+    return len;
+}
+
+/* return   - number of octets in a window of `str` that begins at `pos` and holds `n_starts` match positions*/
+static size_t window_len(const find_needle *needle, size_t pos, size_t n_starts) {
+    return n_starts - pos + needle->len - 1;
+}
+
+char *utf8_find(const char *str, size_t len, const char *needle, size_t needle_len, size_t *out_cp_off) {
+    find_needle n;
+    size_t pos, n_starts, win, off, cps;
+
+    UTF8C_STAT_CALL(utf8_find, len);
+    if (str == NULL || needle == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    if (needle_len == 0) {
+        if (out_cp_off != NULL) {
+            *out_cp_off = 0;
+        }
+        return (char *) str;
+    }
+    if (needle_len > len || UTF8C_IS_CONT(needle[0])) {
+        return NULL;
+    }
+
+    needle_init(&n, needle, needle_len, 0);
+    /* Windows at least as long as the needle keep Two-Way linear*/
+    win = (needle_len > UTF8C_FIND_WINDOW) ? needle_len : UTF8C_FIND_WINDOW;
+    cps = 0;
+    for (pos = 0; pos < len - needle_len + 1; pos += win) {
+        n_starts = (len - needle_len + 1 - pos < win) ? len - needle_len + 1 : pos + win;
+        off = search(&n, str, len, str + pos, window_len(&n, pos, n_starts));
+        if (off != window_len(&n, pos, n_starts)) {
+            if (out_cp_off != NULL) {
+                *out_cp_off = cps + utf8c_count_leads(str + pos, off);
+            }
+            return (char *) str + pos + off;
+        }
+        if (out_cp_off != NULL) {
+            cps += utf8c_count_leads(str + pos, n_starts - pos);
+        }
+    }
+    return NULL;
+}
+
+char *utf8_rfind(const char *str, size_t len, const char *needle, size_t needle_len, size_t *out_cp_off) {
+    find_needle n;
+    size_t lo, hi, win, off, at, last, wlen, end;
+
+    UTF8C_STAT_CALL(utf8_rfind, len);
+    if (str == NULL || needle == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    if (needle_len == 0) {
+        if (out_cp_off != NULL) {
+            *out_cp_off = utf8_distance(str, str + len);
+        }
+        return (char *) str + len;
+    }
+    if (needle_len > len || UTF8C_IS_CONT(needle[0])) {
+        return NULL;
+    }
+
+    if (needle_len >= UTF8C_FIND_TWO_WAY) {
+        /* The reversed needle is searched for in the reversed haystack, its first match is the last one.
+         * A match followed by a continuation octet makes the search resume right before its end*/
+        needle_init(&n, needle, needle_len, 1);
+        for (end = len; end >= needle_len; end = last + needle_len - 1) {
+            off = two_way_rev(&n, str + end - 1, end);
+            if (off == end) {
+                break;
+            }
+            last = end - off - needle_len;
+            if (last + needle_len == len || !UTF8C_IS_CONT(str[last + needle_len])) {
+                if (out_cp_off != NULL) {
+                    *out_cp_off = utf8_distance(str, str + last);
+                }
+                return (char *) str + last;
+            }
+        }
+        return NULL;
+    }
+
+    /* Windows are taken from the end and searched forward, the last match in a window wins*/
+    needle_init(&n, needle, needle_len, 0);
+    win = UTF8C_FIND_WINDOW;
+    for (hi = len - needle_len + 1; hi > 0; hi = lo) {
+        lo = (hi > win) ? hi - win : 0;
+        last = (size_t) -1;
+        for (at = lo; at < hi; at += off + 1) {
+            wlen = window_len(&n, at, hi);
+            off = search(&n, str, len, str + at, wlen);
+            if (off == wlen) {
+                break;
+            }
+            last = at + off;
+        }
+        if (last != (size_t) -1) {
+            /* Code points before the match haven't been seen, they take a pass of their own*/
+            if (out_cp_off != NULL) {
+                *out_cp_off = utf8_distance(str, str + last);
+            }
+            return (char *) str + last;
+        }
+    }
+    return NULL;
+}
+
+char *utf8_find_cp(const char *str, size_t len, utf8_char32 cp, size_t *out_cp_off) {
+    char needle[UTF8C_CP_MAX];
+
+    UTF8C_STAT_CALL(utf8_find_cp, len);
+    if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        errno = UTF8_EILSEQ;
+        return NULL;
+    }
+    return utf8_find(str, len, needle, utf8c_encode(cp, needle), out_cp_off);
+}
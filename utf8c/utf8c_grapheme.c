@@ -0,0 +1,240 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_alloc.h"
+#include "utf8c_grapheme_tables.h"
+#include "utf8c_stats.h"
+
+#define GB(prop) (1u << UTF8C_GB_##prop)
+
+/* Never broken before (GB9, GB9a)*/
+#define GB_ATTACHED (GB(EXTEND) | GB(ZWJ) | GB(SPACINGMARK))
+
+/* Properties that never break after a given one, rules of UAX #29 that depend only on the two
+ * neighbouring code points. GB11 and GB12/GB13 need more context and are checked separately*/
+static const unsigned int gb_joins[] = {
+        GB_ATTACHED,                                                /* Other*/
+        GB(LF),                                                     /* CR (GB3, GB4)*/
+        0,                                                          /* LF (GB4)*/
+        0,                                                          /* Control (GB4)*/
+        GB_ATTACHED,                                                /* Extend*/
+        GB_ATTACHED,                                                /* ZWJ*/
+        GB_ATTACHED,                                                /* Regional_Indicator*/
+        ~(GB(CR) | GB(LF) | GB(CONTROL)),                           /* Prepend (GB9b, GB5)*/
+        GB_ATTACHED,                                                /* SpacingMark*/
+        GB_ATTACHED | GB(L) | GB(V) | GB(LV) | GB(LVT),             /* L (GB6)*/
+        GB_ATTACHED | GB(V) | GB(T),                                /* V (GB7)*/
+        GB_ATTACHED | GB(T),                                        /* T (GB8)*/
+        GB_ATTACHED | GB(V) | GB(T),                                /* LV (GB7)*/
+        GB_ATTACHED | GB(T),                                        /* LVT (GB8)*/
+        GB_ATTACHED                                                 /* Extended_Pictographic*/
+};
+
+/* Progress of GB11: ExtPict Extend* ZWJ x ExtPict*/
+#define EMOJI_NONE 0
+#define EMOJI_BASE 1 /* Extended_Pictographic followed by any number of Extend*/
+#define EMOJI_ZWJ  2 /* The above followed by ZWJ*/
+
+/* Decodes the code point at `s` and looks up its property
+ * `prop`   - pointer to a variable that receives the property, ill-formed octets are Control,
+ *     so that each of them makes up a cluster of its own
+ * return   - number of octets decoded*/
+static size_t next_prop(const unsigned char *s, const unsigned char *end, unsigned int *prop) {
+    utf8_char32 cp;
+    size_t n, k;
+
+    cp = s[0];
+    if (cp < 0x80) {
+        *prop = utf8c_gb_stage2[cp];
+        return 1;
+    }
+    if (cp < 0xC2 || cp >= 0xF5) {
+        *prop = UTF8C_GB_CONTROL;
+        return 1;
+    }
+    n = (cp >= 0xF0) ? 4 : (cp >= 0xE0) ? 3 : 2;
+    if ((size_t) (end - s) < n) {
+        *prop = UTF8C_GB_CONTROL;
+        return 1;
+    }
+
+    cp &= 0x3F >> (n - 1);
+    for (k = 1; k < n; k++) {
+        if (!UTF8C_IS_CONT(s[k])) {
+            *prop = UTF8C_GB_CONTROL;
+            return 1;
+        }
+        cp = (cp << 6) | (s[k] & 0x3F);
+    }
+    if (cp >= 0x110000) {
+        *prop = UTF8C_GB_CONTROL;
+        return 1;
+    }
+    *prop = utf8c_gb_stage2[((size_t) utf8c_gb_stage1[cp >> UTF8C_GB_SHIFT] << UTF8C_GB_SHIFT)
+                            + (cp & UTF8C_GB_MASK)];
+    return n;
+}
+
+/* `s`      - pointer to the first octet of a cluster, must be less than `end`
+ * return   - pointer past the last octet of the cluster*/
+static const unsigned char *cluster_end(const unsigned char *s, const unsigned char *end) {
+    unsigned int prev, cur, emoji;
+    size_t ri, n;
+
+    /* ASCII followed by ASCII is always a break, unless it's CR LF*/
+    if (s[0] < 0x80 && (s + 1 == end || (s[1] < 0x80 && (s[0] != '\r' || s[1] != '\n')))) {
+        return s + 1;
+    }
+
+    s += next_prop(s, end, &prev);
+    emoji = (prev == UTF8C_GB_EXTENDED_PICTOGRAPHIC) ? EMOJI_BASE : EMOJI_NONE;
+    ri = (prev == UTF8C_GB_REGIONAL_INDICATOR);
+    while (s != end) {
+        n = next_prop(s, end, &cur);
+        if ((gb_joins[prev] & (1u << cur)) == 0
+            && !(prev == UTF8C_GB_ZWJ && cur == UTF8C_GB_EXTENDED_PICTOGRAPHIC && emoji == EMOJI_ZWJ) /* GB11*/
+            && !(prev == UTF8C_GB_REGIONAL_INDICATOR && cur == UTF8C_GB_REGIONAL_INDICATOR
+                 && ri % 2 == 1)) { /* GB12, GB13: flags are pairs of regional indicators*/
+            break;
+        }
+
+        if (cur == UTF8C_GB_EXTENDED_PICTOGRAPHIC) {
+            emoji = EMOJI_BASE;
+        } else if (emoji == EMOJI_BASE && cur == UTF8C_GB_ZWJ) {
+            emoji = EMOJI_ZWJ;
+        } else if (emoji != EMOJI_BASE || cur != UTF8C_GB_EXTEND) {
+            emoji = EMOJI_NONE;
+        }
+        ri = (cur == UTF8C_GB_REGIONAL_INDICATOR) ? ri + 1 : 0;
+        prev = cur;
+        s += n;
+    }
+    return s;
+}
+
+char *utf8_grapheme_next(const char *begin, const char *end) {
+    UTF8C_STAT_CALL(utf8_grapheme_next, 0);
+    if (begin == NULL || end == NULL || begin >= end) {
+        return NULL;
+    }
+    return (char *) cluster_end((const unsigned char *) begin, (const unsigned char *) end);
+}
+
+size_t utf8_grapheme_count(const char *begin, const char *end) {
+    const unsigned char *s, *e;
+    const char *cr;
+    size_t count, n;
+
+    UTF8C_STAT_CALL(utf8_grapheme_count, UTF8C_STAT_SPAN(begin, end));
+    if (begin == NULL || end == NULL || begin > end) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    s = (const unsigned char *) begin;
+    e = (const unsigned char *) end;
+    count = 0;
+    while (s != e) {
+        if (s[0] < 0x80) {
+            /* Every ASCII code point of a run is a cluster, except for the last one, which may be extended
+             * by what follows, and the CR of CR LF*/
+            n = utf8c_skip_ascii((const char *) s, (size_t) (e - s)) - 1;
+            if (n > 0 && s[n - 1] == '\r' && s[n] == '\n') {
+                n--;
+            }
+            count += n;
+            cr = (const char *) s;
+            while ((cr = memchr(cr, '\r', (size_t) ((const char *) s + n - cr))) != NULL) {
+                if (cr[1] == '\n') {
+                    count--;
+                }
+                cr++;
+            }
+            s += n;
+        }
+        s = cluster_end(s, e);
+        count++;
+    }
+    return count;
+}
+
+char **utf8_grapheme_to_arr(const char *str) {
+    UTF8C_STAT_CALL(utf8_grapheme_to_arr, 0);
+    return utf8_grapheme_to_arr_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, NULL);
+}
+
+char **utf8_grapheme_to_arr_n(const char *str, size_t len, size_t *out_count) {
+    UTF8C_STAT_CALL(utf8_grapheme_to_arr_n, len);
+    return utf8_grapheme_to_arr_a(NULL, str, len, out_count);
+}
+
+char **utf8_grapheme_to_arr_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_count) {
+    size_t count, i;
+    const char *end, *next;
+    char **arr, *grapheme;
+
+    UTF8C_STAT_CALL(utf8_grapheme_to_arr_a, len);
+    if (str == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    end = &str[len];
+    count = utf8_grapheme_count(str, end);
+    UTF8C_STAT_RESUME(utf8_grapheme_to_arr_a);
+
+    arr = utf8c_alloc(alloc, sizeof(char *) * (count + 1));
+    if (arr == NULL) {
+        errno = UTF8_ENOMEM;
+        return NULL;
+    }
+
+    for (i = 0; i < count; i++) {
+        next = (const char *) cluster_end((const unsigned char *) str, (const unsigned char *) end);
+        grapheme = utf8c_alloc(alloc, sizeof(char) * (next - str + 1));
+        if (grapheme == NULL) {
+            errno = UTF8_ENOMEM;
+            goto fail;
+        }
+        memcpy(grapheme, str, sizeof(char) * (next - str));
+        grapheme[next - str] = '\0';
+        arr[i] = grapheme;
+        str = next;
+    }
+    arr[count] = NULL;
+    if (out_count != NULL) {
+        *out_count = count;
+    }
+    return arr;
+
+    fail:
+    while (i-- > 0) {
+        utf8c_free(alloc, arr[i]);
+    }
+    utf8c_free(alloc, arr);
+    return NULL;
+}
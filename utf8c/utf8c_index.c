@@ -0,0 +1,147 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_alloc.h"
+#include "utf8c_stats.h"
+
+utf8_index *utf8_index_create(const char *str, size_t len, size_t step) {
+    UTF8C_STAT_CALL(utf8_index_create, len);
+    return utf8_index_create_a(NULL, str, len, step);
+}
+
+utf8_index *utf8_index_create_a(const utf8_allocator *alloc, const char *str, size_t len, size_t step) {
+    size_t n_cps, n_checkpoints, i;
+    const char *it, *end;
+    utf8_index *index;
+
+    UTF8C_STAT_CALL(utf8_index_create_a, len);
+    if (str == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    if (step == 0) {
+        step = UTF8_INDEX_STEP;
+    }
+
+    end = &str[len];
+    n_cps = utf8_distance(str, end);
+    n_checkpoints = n_cps / step + 1;
+    UTF8C_STAT_RESUME(utf8_index_create_a);
+
+    /* Checkpoints are stored right after the header, so the whole index is a single allocation*/
+    index = (utf8_index *) utf8c_alloc(alloc, sizeof(utf8_index) + sizeof(size_t) * n_checkpoints);
+    if (index == NULL) {
+        errno = UTF8_ENOMEM;
+        return NULL;
+    }
+
+    index->alloc = alloc;
+    index->str = str;
+    index->len = len;
+    index->n_cps = n_cps;
+    index->step = step;
+    index->n_checkpoints = n_checkpoints;
+    index->checkpoints = (size_t *) (index + 1);
+
+    it = str;
+    index->checkpoints[0] = 0;
+    for (i = 1; i < n_checkpoints; i++) {
+        it = utf8_advance(it, step, end);
+        index->checkpoints[i] = (size_t) (it - str);
+    }
+    return index;
+}
+
+void utf8_index_free(utf8_index *index) {
+    UTF8C_STAT_CALL(utf8_index_free, 0);
+    if (index == NULL) {
+        errno = UTF8_EINVAL;
+        return;
+    }
+    utf8c_free(index->alloc, index);
+}
+
+char *utf8_index_advance(const utf8_index *index, size_t off) {
+    UTF8C_STAT_CALL(utf8_index_advance, 0);
+    if (index == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    if (off > index->n_cps) { /* Can't advance string as `off` is bigger than number of code points available*/
+        return NULL;
+    }
+
+    return utf8_advance(&index->str[index->checkpoints[off / index->step]], off % index->step,
+                        &index->str[index->len]);
+}
+
+size_t utf8_index_offset(const utf8_index *index, const char *it) {
+    size_t octet, lo, hi, mid;
+
+    UTF8C_STAT_CALL(utf8_index_offset, 0);
+    if (index == NULL || it == NULL || it < index->str || it > &index->str[index->len]) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    /* Find the last checkpoint which is not after `it`*/
+    octet = (size_t) (it - index->str);
+    lo = 0;
+    hi = index->n_checkpoints;
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (index->checkpoints[mid] <= octet) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo * index->step + utf8_distance(&index->str[index->checkpoints[lo]], it);
+}
+
+char *utf8_index_substr(const utf8_index *index, size_t off, size_t count, size_t *out_len) {
+    const char *it_begin, *it_end;
+
+    UTF8C_STAT_CALL(utf8_index_substr, 0);
+    if (index == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    it_begin = utf8_index_advance(index, off);
+    if (it_begin == NULL) { /* Can't advance string's `off`set, it goes beyond last string code point*/
+        errno = UTF8_ERANGE;
+        return NULL;
+    }
+
+    it_end = (count == utf8_npos || count >= index->n_cps - off)
+             ? &index->str[index->len]
+             : utf8_index_advance(index, off + count);
+
+    return utf8_strcpy_n(it_begin, (size_t) (it_end - it_begin), out_len);
+}
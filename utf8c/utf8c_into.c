@@ -0,0 +1,278 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* _into variants: results are written to caller memory instead of being allocated. Like snprintf they
+ * always \0 terminate, truncate what doesn't fit and return the number of octets the whole result takes*/
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_into.h"
+#include "utf8c_stats.h"
+
+/* A code point takes at most this many continuation octets, so a cut never steps back further*/
+#define UTF8C_INTO_MAX_CONT 3
+
+void utf8c_into_begin(utf8c_into *out, char *dst, size_t dst_cap) {
+    out->dst = dst;
+    out->room = (dst_cap != 0) ? dst_cap - 1 : 0;
+    out->pos = 0;
+    out->full = 0;
+    out->next = '\0';
+}
+
+void utf8c_into_put(utf8c_into *out, const char *src, size_t n) {
+    if (out->full || n == 0) {
+        return;
+    }
+    if (n > out->room) {
+        if (out->room != 0) {
+            memcpy(out->dst + out->pos, src, sizeof(char) * out->room);
+            out->pos += out->room;
+        }
+        out->next = src[out->room];
+        out->room = 0;
+        out->full = 1;
+        return;
+    }
+    memcpy(out->dst + out->pos, src, sizeof(char) * n);
+    out->pos += n;
+    out->room -= n;
+}
+
+size_t utf8c_into_end(utf8c_into *out, size_t dst_cap, size_t total) {
+    char c;
+    int i;
+
+    if (dst_cap == 0) {
+        return total;
+    }
+    if (out->full) {
+        c = out->next;
+        for (i = 0; i < UTF8C_INTO_MAX_CONT && out->pos > 0 && UTF8C_IS_CONT(c); i++) {
+            c = out->dst[--out->pos];
+        }
+    }
+    out->dst[out->pos] = '\0';
+    return total;
+}
+
+size_t utf8_substr_into(char *dst, size_t dst_cap, const char *str, size_t len, size_t off, size_t count) {
+    const char *begin, *end, *it_begin, *it_end;
+    utf8c_into out;
+
+    UTF8C_STAT_CALL(utf8_substr_into, len);
+    if (str == NULL || (dst == NULL && dst_cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    begin = &str[0];
+    end = &str[len];
+
+    it_begin = utf8_advance(begin, off, end);
+    if (it_begin == NULL) {
+        errno = UTF8_ERANGE;
+        return utf8_npos;
+    }
+
+    it_end = (count == utf8_npos)
+             ? end
+             : utf8_advance(it_begin, count, end);
+    if (it_end == NULL) {
+        it_end = end;
+    }
+
+    utf8c_into_begin(&out, dst, dst_cap);
+    utf8c_into_put(&out, it_begin, (size_t) (it_end - it_begin));
+    return utf8c_into_end(&out, dst_cap, (size_t) (it_end - it_begin));
+}
+
+size_t utf8_join_into(char *dst, size_t dst_cap, const char *str, size_t len, const char *joiner, size_t joiner_len) {
+    size_t n_joiners, total, fit, i;
+    utf8c_into out;
+
+    UTF8C_STAT_CALL(utf8_join_into, len);
+    if (str == NULL || joiner == NULL || (dst == NULL && dst_cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    utf8c_into_begin(&out, dst, dst_cap);
+    if (len < 2 || joiner_len == 0) { /* Unchanged copy, same as utf8_join_n*/
+        utf8c_into_put(&out, str, len);
+        return utf8c_into_end(&out, dst_cap, len);
+    }
+
+    n_joiners = utf8_distance(str, &str[len]) - UTF8C_IS_LEAD(str[0]);
+    if (n_joiners != 0 && joiner_len > ((size_t) -1 - 1 - len) / n_joiners) {
+        errno = UTF8_ERANGE;
+        return utf8_npos;
+    }
+    total = len + joiner_len * n_joiners;
+
+    if (total <= out.room) {
+        utf8c_join(str, len, joiner, joiner_len, dst);
+        out.pos = total;
+        return utf8c_into_end(&out, dst_cap, total);
+    }
+
+    /* Joining a prefix of at most room / (joiner_len + 1) octets can't overflow the room even if every one
+     * of them starts a code point. The prefix ends before a lead octet, so a joiner follows it*/
+    fit = out.room / (joiner_len + 1);
+    while (fit > 0 && !UTF8C_IS_LEAD(str[fit])) {
+        fit--;
+    }
+    if (fit > 0) {
+        out.pos = utf8c_join(str, fit, joiner, joiner_len, dst);
+        out.room -= out.pos;
+        utf8c_into_put(&out, joiner, joiner_len);
+    }
+    for (i = fit; i < len && !out.full; i++) {
+        utf8c_into_put(&out, &str[i], 1);
+        if (i + 1 < len && UTF8C_IS_LEAD(str[i + 1])) {
+            utf8c_into_put(&out, joiner, joiner_len);
+        }
+    }
+    return utf8c_into_end(&out, dst_cap, total);
+}
+
+size_t utf8_repeat_into(char *dst, size_t dst_cap, const char *str, size_t len, size_t n) {
+    size_t total, written, block, chunk;
+    utf8c_into out;
+
+    UTF8C_STAT_CALL(utf8_repeat_into, len);
+    if (str == NULL || (dst == NULL && dst_cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    if (n != 0 && len > ((size_t) -1 - 1) / n) {
+        errno = UTF8_ERANGE;
+        return utf8_npos;
+    }
+
+    total = len * n;
+    utf8c_into_begin(&out, dst, dst_cap);
+    if (total == 0) {
+        return utf8c_into_end(&out, dst_cap, total);
+    }
+
+    /* Whatever fits is filled by doubling what's already written, as utf8_repeat does*/
+    written = (total < out.room) ? total : out.room;
+    if (written != 0) {
+        block = (len < written) ? len : written;
+        memcpy(dst, str, sizeof(char) * block);
+        for (; block < written; block += chunk) {
+            chunk = (block < written - block) ? block : written - block;
+            memcpy(dst + block, dst, sizeof(char) * chunk);
+        }
+    }
+    out.pos = written;
+    if (written < total) {
+        out.full = 1;
+        out.next = str[written % len];
+    }
+    return utf8c_into_end(&out, dst_cap, total);
+}
+
+size_t utf8_strcat_into(char *dst, size_t dst_cap, const char *a, size_t len_a, const char *b, size_t len_b) {
+    utf8c_into out;
+
+    UTF8C_STAT_CALL(utf8_strcat_into, len_a + len_b);
+    if (a == NULL || b == NULL || (dst == NULL && dst_cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    if (len_a > (size_t) -1 - 1 || len_b > (size_t) -1 - 1 - len_a) {
+        errno = UTF8_ERANGE;
+        return utf8_npos;
+    }
+
+    utf8c_into_begin(&out, dst, dst_cap);
+    utf8c_into_put(&out, a, len_a);
+    utf8c_into_put(&out, b, len_b);
+    return utf8c_into_end(&out, dst_cap, len_a + len_b);
+}
+
+size_t utf8_vstrcat_into(char *dst, size_t dst_cap, size_t n_str, ...) {
+    size_t len, i, temp_len;
+    const char *str;
+    utf8c_into out;
+    va_list args;
+
+    UTF8C_STAT_CALL(utf8_vstrcat_into, 0);
+    if (dst == NULL && dst_cap != 0) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    utf8c_into_begin(&out, dst, dst_cap);
+    va_start(args, n_str);
+    for (i = 0, len = 0; i < n_str; i++) {
+        str = va_arg(args, const char *);
+        temp_len = va_arg(args, size_t);
+        if (str == NULL) {
+            va_end(args);
+            errno = UTF8_EINVAL;
+            return utf8_npos;
+        }
+        if (temp_len > (size_t) -1 - 1 - len) {
+            va_end(args);
+            errno = UTF8_ERANGE;
+            return utf8_npos;
+        }
+        utf8c_into_put(&out, str, temp_len);
+        len += temp_len;
+    }
+    va_end(args);
+
+    return utf8c_into_end(&out, dst_cap, len);
+}
+
+size_t utf8_to_str_into(char *dst, size_t dst_cap, char *const *arr, const size_t *lens, size_t n) {
+    size_t len, i, temp_len;
+    utf8c_into out;
+
+    UTF8C_STAT_CALL(utf8_to_str_into, 0);
+    if (arr == NULL || (dst == NULL && dst_cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    utf8c_into_begin(&out, dst, dst_cap);
+    for (i = 0, len = 0; i < n; i++) {
+        temp_len = (lens != NULL) ? lens[i] : utf8c_strlen(arr[i]);
+        if (temp_len > (size_t) -1 - 1 - len) {
+            errno = UTF8_ERANGE;
+            return utf8_npos;
+        }
+        utf8c_into_put(&out, arr[i], temp_len);
+        len += temp_len;
+    }
+
+    return utf8c_into_end(&out, dst_cap, len);
+}
@@ -0,0 +1,51 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Internal bounded output of the _into functions, shared by utf8c translation units. Not part of the public API.*/
+#ifndef UTF8C_INTO_H
+#define UTF8C_INTO_H
+
+#include "utf8c.h"
+
+/* Destination of an _into function. Octets that don't fit are dropped, the first of them is kept in `next`
+ * so that the end can be moved back to a code point boundary*/
+typedef struct utf8c_into {
+    char *dst;
+    size_t room;    /* Number of octets that still fit before the \0*/
+    size_t pos;     /* Number of octets written*/
+    int full;       /* Whether some octets were dropped*/
+    char next;      /* First dropped octet*/
+} utf8c_into;
+
+/* `dst`    - pointer to a buffer of `dst_cap` octets, can be NULL if `dst_cap` is 0*/
+void utf8c_into_begin(utf8c_into *out, char *dst, size_t dst_cap);
+
+/* Writes as much of `n` octets of `src` as fits*/
+void utf8c_into_put(utf8c_into *out, const char *src, size_t n);
+
+/* Drops a partially written code point and terminates the output
+ * return   - `total`, so that _into functions can return the result*/
+size_t utf8c_into_end(utf8c_into *out, size_t dst_cap, size_t total);
+
+#endif /* UTF8C_INTO_H*/
@@ -0,0 +1,2849 @@
+/* Generated by tools/gen_norm_tables.py from UnicodeData.txt, CompositionExclusions-14.0.0.txt and CaseFolding-14.0.0.txt. Do not edit*/
+#ifndef UTF8C_NORM_TABLES_H
+#define UTF8C_NORM_TABLES_H
+
+/* Record of `cp` is utf8c_norm_records[utf8c_norm_stage2[(utf8c_norm_stage1[cp >> UTF8C_NORM_SHIFT] << UTF8C_NORM_SHIFT)
+ * + (cp & UTF8C_NORM_MASK)]]*/
+#define UTF8C_NORM_SHIFT 6
+#define UTF8C_NORM_MASK 0x3F
+
+static const unsigned char utf8c_norm_stage1[17408] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+        22, 23, 0, 24, 25, 26, 0, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 34, 40, 41, 42,
+        38, 43, 38, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 0, 57, 58, 0, 59, 60, 61,
+        0, 0, 0, 0, 0, 62, 0, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 65,
+        0, 0, 66, 0, 67, 0, 0, 0, 68, 69, 70, 71, 72, 73, 74, 75, 76, 0, 77, 78, 0, 0, 0, 79,
+        80, 81, 82, 83, 84, 85, 86, 87, 88, 0, 0, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 0, 0, 0,
+        0, 0, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 101, 0, 0, 0, 0, 102, 103, 104, 105, 0, 106, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0,
+        108, 109, 110, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 113, 114, 115, 116, 117, 118,
+        119, 0, 0, 120, 121, 122, 123, 124, 0, 0, 125, 126, 0, 127, 128, 129, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 142, 0, 0, 0, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144,
+        0, 0, 0, 145, 0, 146, 0, 0, 147, 0, 148, 149, 0, 150, 151, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 153, 0, 0, 0, 0, 0, 0, 154, 0, 155, 0, 0, 0,
+        0, 0, 156, 0, 0, 157, 158, 0, 0, 159, 160, 0, 161, 123, 0, 162, 163, 0, 0, 164, 165, 166, 0, 0,
+        0, 167, 168, 169, 0, 0, 170, 171, 106, 0, 172, 0, 173, 0, 0, 0, 174, 0, 175, 0, 176, 177, 0, 178,
+        179, 180, 181, 0, 0, 0, 0, 0, 106, 0, 0, 0, 0, 182, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 186, 0, 0, 0, 0, 0, 187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 189, 190, 191, 0, 192, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        193, 0, 0, 0, 185, 0, 0, 0, 0, 0, 194, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196, 197, 198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 200, 201, 202, 203, 204, 205, 206,
+        207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const unsigned short utf8c_norm_stage2[13312] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+        44, 45, 46, 47, 48, 49, 50, 0, 51, 52, 53, 54, 55, 56, 57, 58,
+        59, 60, 61, 62, 63, 64, 0, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+        0, 74, 75, 76, 77, 78, 79, 0, 0, 80, 81, 82, 83, 84, 0, 85,
+        86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+        102, 0, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+        117, 118, 119, 120, 121, 122, 123, 0, 124, 125, 126, 127, 128, 129, 130, 131,
+        132, 0, 133, 0, 134, 135, 136, 137, 0, 138, 139, 140, 141, 142, 143, 144,
+        0, 145, 0, 146, 147, 148, 149, 150, 151, 152, 153, 0, 154, 155, 156, 157,
+        158, 159, 160, 0, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172,
+        173, 174, 175, 176, 177, 178, 179, 0, 180, 181, 182, 183, 184, 185, 186, 187,
+        188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 19,
+        0, 203, 204, 0, 205, 0, 206, 207, 0, 208, 209, 210, 0, 0, 211, 212,
+        213, 214, 0, 215, 216, 0, 217, 218, 219, 0, 0, 0, 220, 221, 0, 222,
+        223, 224, 225, 0, 226, 0, 227, 228, 0, 229, 0, 0, 230, 0, 231, 232,
+        233, 234, 235, 236, 0, 237, 0, 238, 239, 0, 0, 0, 240, 0, 0, 0,
+        0, 0, 0, 0, 241, 241, 0, 242, 242, 0, 243, 243, 0, 244, 245, 246,
+        247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 0, 260, 261,
+        262, 263, 264, 265, 266, 0, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+        277, 278, 278, 0, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290,
+        291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+        307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 0, 320, 321,
+        322, 0, 323, 0, 324, 0, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334,
+        335, 336, 337, 338, 0, 0, 0, 0, 0, 0, 339, 340, 0, 341, 342, 0,
+        0, 343, 0, 344, 345, 346, 347, 0, 348, 0, 349, 0, 350, 0, 351, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 353, 352, 352, 352, 352, 352, 352, 352, 353, 353, 352,
+        353, 352, 353, 352, 352, 354, 355, 355, 355, 355, 354, 356, 355, 355, 355, 355,
+        355, 357, 357, 358, 358, 358, 358, 359, 359, 355, 355, 355, 355, 358, 358, 355,
+        358, 358, 355, 355, 360, 360, 360, 360, 361, 355, 355, 355, 355, 353, 353, 353,
+        362, 363, 352, 364, 365, 366, 353, 355, 355, 355, 353, 353, 353, 355, 355, 0,
+        353, 353, 353, 355, 355, 355, 355, 353, 354, 355, 355, 353, 367, 368, 368, 367,
+        368, 368, 367, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353,
+        369, 0, 370, 0, 371, 0, 372, 0, 0, 0, 0, 0, 0, 0, 373, 374,
+        0, 0, 0, 0, 0, 375, 376, 377, 378, 379, 380, 0, 381, 0, 382, 383,
+        384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 27, 396, 397, 398,
+        399, 400, 0, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
+        414, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 401, 0, 0, 0, 0, 0, 0, 0, 415, 416, 417, 418, 419, 420,
+        386, 392, 0, 421, 422, 404, 399, 0, 423, 0, 424, 0, 425, 0, 426, 0,
+        427, 0, 428, 0, 429, 0, 430, 0, 431, 0, 432, 0, 433, 0, 434, 0,
+        394, 400, 0, 0, 392, 389, 0, 435, 0, 436, 437, 0, 0, 438, 439, 440,
+        441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456,
+        457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472,
+        473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 489, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        490, 491, 0, 492, 0, 0, 0, 493, 0, 0, 0, 0, 494, 495, 496, 0,
+        497, 0, 498, 0, 499, 0, 500, 0, 501, 0, 502, 0, 503, 0, 504, 0,
+        505, 0, 506, 0, 507, 0, 508, 509, 510, 0, 511, 0, 512, 0, 513, 0,
+        514, 0, 0, 353, 353, 353, 353, 353, 0, 0, 515, 0, 516, 0, 517, 0,
+        518, 0, 519, 0, 520, 0, 521, 0, 522, 0, 523, 0, 524, 0, 525, 0,
+        526, 0, 527, 0, 528, 0, 529, 0, 530, 0, 531, 0, 532, 0, 533, 0,
+        534, 0, 535, 0, 536, 0, 537, 0, 538, 0, 539, 0, 540, 0, 541, 0,
+        542, 543, 544, 545, 0, 546, 0, 547, 0, 548, 0, 549, 0, 550, 0, 0,
+        551, 552, 553, 554, 555, 0, 556, 557, 558, 0, 559, 560, 561, 562, 563, 564,
+        565, 0, 566, 567, 568, 569, 570, 571, 572, 0, 573, 574, 575, 576, 577, 578,
+        579, 580, 581, 582, 583, 584, 585, 0, 586, 587, 588, 0, 589, 0, 590, 0,
+        591, 0, 592, 0, 593, 0, 594, 0, 595, 0, 596, 0, 597, 0, 598, 0,
+        599, 0, 600, 0, 601, 0, 602, 0, 603, 0, 604, 0, 605, 0, 606, 0,
+        607, 0, 608, 0, 609, 0, 610, 0, 611, 0, 612, 0, 613, 0, 614, 0,
+        0, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
+        630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645,
+        646, 647, 648, 649, 650, 651, 652, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 355, 353, 353, 353, 353, 355, 353, 353, 353, 654, 355, 353, 353, 353, 353,
+        353, 353, 355, 355, 355, 355, 355, 355, 353, 353, 355, 353, 353, 654, 655, 353,
+        656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 665, 666, 667, 668, 0, 669,
+        0, 670, 671, 0, 353, 355, 0, 664, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 353, 353, 353, 353, 353, 353, 672, 673, 674, 0, 0, 0, 0, 0,
+        0, 0, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 680, 681, 682, 672, 673,
+        674, 683, 684, 352, 352, 358, 355, 353, 353, 353, 353, 353, 355, 353, 353, 355,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        686, 0, 687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 688, 0, 0, 353, 353, 353, 353, 353, 353, 353, 0, 0, 353,
+        353, 353, 353, 355, 353, 0, 0, 353, 353, 0, 355, 353, 353, 355, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 355, 353, 353, 355, 353, 353, 355, 355, 355, 353, 355, 355, 353, 355, 353,
+        353, 353, 355, 353, 355, 353, 355, 353, 355, 353, 353, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 353, 353, 353, 353,
+        353, 353, 355, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 353, 353, 353, 353, 0, 353, 353, 353, 353, 353,
+        353, 353, 353, 353, 0, 353, 353, 353, 0, 353, 353, 353, 353, 353, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 355, 355, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 353, 355, 355, 355, 353, 353, 353, 353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 353, 353, 353, 353, 355,
+        355, 355, 355, 355, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353,
+        353, 353, 0, 355, 353, 353, 355, 353, 353, 355, 353, 353, 353, 355, 355, 355,
+        680, 681, 682, 353, 353, 353, 355, 353, 353, 355, 355, 353, 353, 353, 353, 353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0,
+        0, 691, 0, 0, 692, 0, 0, 0, 0, 0, 0, 0, 693, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 0, 0,
+        0, 353, 355, 353, 353, 0, 0, 0, 695, 696, 697, 698, 699, 700, 701, 702,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 703, 0, 704, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 705, 706, 694, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 704, 0, 0, 0, 0, 707, 708, 0, 709,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 710, 0, 0, 711, 0, 0, 0, 0, 0, 703, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 712, 713, 714, 0, 0, 715, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 703, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 716, 0, 0, 717, 718, 694, 0, 0,
+        0, 0, 0, 0, 0, 0, 704, 704, 0, 0, 0, 0, 719, 720, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 704, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 722, 723, 724, 694, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 704, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 725, 0, 0, 0, 0, 694, 0, 0,
+        0, 0, 0, 0, 0, 726, 727, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        728, 0, 704, 0, 0, 0, 0, 729, 730, 0, 731, 732, 0, 694, 0, 0,
+        0, 0, 0, 0, 0, 704, 704, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 694, 0, 704, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 733, 734, 735, 694, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 704, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 736, 0, 0, 0, 0, 704,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 737, 0, 738, 739, 740, 704,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 741, 741, 694, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 742, 742, 742, 742, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 743, 743, 694, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 744, 744, 744, 744, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 355, 355, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 355, 0, 355, 0, 745, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
+        0, 0, 748, 0, 0, 0, 0, 749, 0, 0, 0, 0, 750, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 751, 0, 0, 0, 0, 0, 0,
+        0, 752, 753, 754, 755, 756, 757, 0, 758, 0, 753, 753, 753, 753, 0, 0,
+        753, 759, 353, 353, 694, 0, 353, 353, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 0, 0,
+        0, 0, 762, 0, 0, 0, 0, 763, 0, 0, 0, 0, 764, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 355, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 766, 0, 0, 0, 0, 0, 0, 0, 704, 0,
+        0, 0, 0, 0, 0, 0, 0, 703, 0, 694, 694, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782,
+        783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798,
+        799, 800, 801, 802, 803, 804, 0, 805, 0, 0, 0, 0, 0, 806, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704,
+        704, 704, 704, 704, 704, 704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 704, 704, 704, 704, 704, 704, 704, 704,
+        704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704,
+        704, 704, 704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 353, 353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 807, 808, 809, 810, 811, 812, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 694, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 654, 353, 355, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 353, 355, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 353, 353, 353, 353, 353, 353, 353, 353, 0, 0, 355,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 353, 353, 353, 355, 355, 355, 355, 355, 355, 353, 353, 355, 0, 355,
+        355, 353, 353, 355, 355, 353, 353, 353, 353, 353, 355, 353, 353, 353, 353, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 813, 0, 814, 0, 815, 0, 816, 0, 817, 0,
+        0, 0, 818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 703, 704, 0, 0, 0, 0, 0, 819, 0, 820, 0, 0,
+        821, 822, 0, 823, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 355, 353, 353, 353,
+        353, 353, 353, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 694, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 703, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 694, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 703, 0, 0, 0, 0, 0, 0, 0, 0,
+        459, 461, 471, 474, 475, 475, 483, 498, 824, 0, 0, 0, 0, 0, 0, 0,
+        825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840,
+        841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856,
+        857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 0, 0, 868, 869, 870,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 353, 0, 360, 355, 355, 355, 355, 355, 353, 353, 355, 355, 355, 355,
+        353, 0, 360, 360, 360, 360, 360, 360, 360, 0, 0, 0, 0, 355, 0, 0,
+        0, 0, 0, 0, 353, 0, 0, 0, 353, 353, 0, 0, 0, 0, 0, 0,
+        353, 353, 355, 353, 353, 353, 353, 353, 353, 353, 355, 353, 353, 368, 871, 355,
+        357, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353,
+        353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353,
+        353, 353, 353, 353, 353, 353, 354, 655, 655, 355, 872, 353, 367, 355, 353, 355,
+        873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888,
+        889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904,
+        905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920,
+        921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936,
+        937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952,
+        953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968,
+        969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984,
+        985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000,
+        1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+        1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 0, 0, 58, 0,
+        1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
+        1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
+        1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+        1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
+        1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108,
+        1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 0, 1120, 0, 1121, 0,
+        1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137,
+        1138, 1139, 1140, 1141, 1142, 1143, 0, 0, 1144, 1145, 1146, 1147, 1148, 1149, 0, 0,
+        1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
+        1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181,
+        1182, 1183, 1184, 1185, 1186, 1187, 0, 0, 1188, 1189, 1190, 1191, 1192, 1193, 0, 0,
+        1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 0, 1202, 0, 1203, 0, 1204, 0, 1205,
+        1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
+        1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 0, 0,
+        1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251,
+        1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+        1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
+        1284, 1285, 1286, 1287, 1288, 0, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 0, 1296, 0,
+        0, 1297, 1298, 1299, 1300, 0, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310,
+        1311, 1312, 1313, 1314, 0, 0, 1315, 1316, 1317, 1318, 1319, 1320, 0, 1321, 1322, 1323,
+        1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+        0, 0, 1340, 1341, 1342, 0, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 0, 0,
+        1351, 1352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 360, 360, 353, 353, 353, 353, 360, 360, 360, 353, 353, 0, 0, 0,
+        0, 353, 0, 0, 0, 360, 360, 353, 355, 353, 360, 360, 355, 355, 355, 355,
+        353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1353, 0, 0, 0, 1354, 1355, 0, 0, 0, 0,
+        0, 0, 1356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1374, 1375, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1376, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1377, 1378, 1379,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1380, 0, 0, 0, 0, 1381, 0, 0, 1382, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1383, 0, 1384, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1385, 0, 0, 1386, 0, 0, 1387, 0, 1388, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1389, 0, 1390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1391, 1392, 1393,
+        1394, 1395, 0, 0, 1396, 1397, 0, 0, 1398, 1399, 0, 0, 0, 0, 0, 0,
+        1400, 1401, 0, 0, 1402, 1403, 0, 0, 1404, 1405, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1406, 1407, 1408, 1409,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1410, 1411, 1412, 1413, 0, 0, 0, 0, 0, 0, 1414, 1415, 1416, 1417, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1418, 1419, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429,
+        1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1446, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462,
+        1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478,
+        1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1495, 0, 1496, 1497, 1498, 0, 0, 1499, 0, 1500, 0, 1501, 0, 1502, 1503, 1504,
+        1505, 0, 1506, 0, 0, 1507, 0, 0, 0, 0, 0, 0, 0, 0, 1508, 1509,
+        1510, 0, 1511, 0, 1512, 0, 1513, 0, 1514, 0, 1515, 0, 1516, 0, 1517, 0,
+        1518, 0, 1519, 0, 1520, 0, 1521, 0, 1522, 0, 1523, 0, 1524, 0, 1525, 0,
+        1526, 0, 1527, 0, 1528, 0, 1529, 0, 1530, 0, 1531, 0, 1532, 0, 1533, 0,
+        1534, 0, 1535, 0, 1536, 0, 1537, 0, 1538, 0, 1539, 0, 1540, 0, 1541, 0,
+        1542, 0, 1543, 0, 1544, 0, 1545, 0, 1546, 0, 1547, 0, 1548, 0, 1549, 0,
+        1550, 0, 1551, 0, 1552, 0, 1553, 0, 1554, 0, 1555, 0, 1556, 0, 1557, 0,
+        1558, 0, 1559, 0, 0, 0, 0, 0, 0, 0, 0, 1560, 0, 1561, 0, 353,
+        353, 353, 1562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353,
+        353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 872, 655, 354, 654, 1563, 1563,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1564, 0, 1565, 0,
+        1566, 0, 1567, 0, 1568, 0, 1569, 0, 1570, 0, 1571, 0, 1572, 0, 1573, 0,
+        1574, 0, 1575, 0, 0, 1576, 0, 1577, 0, 1578, 0, 0, 0, 0, 0, 0,
+        1579, 1580, 0, 1581, 1582, 0, 1583, 1584, 0, 1585, 1586, 0, 1587, 1588, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1589, 0, 0, 0, 0, 1590, 1590, 0, 0, 0, 1591, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1592, 0, 1593, 0,
+        1594, 0, 1595, 0, 1596, 0, 1597, 0, 1598, 0, 1599, 0, 1600, 0, 1601, 0,
+        1602, 0, 1603, 0, 0, 1604, 0, 1605, 0, 1606, 0, 0, 0, 0, 0, 0,
+        1607, 1608, 0, 1609, 1610, 0, 1611, 1612, 0, 1613, 1614, 0, 1615, 1616, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1617, 0, 0, 1618, 1619, 1620, 1621, 0, 0, 0, 1622, 0,
+        1623, 0, 1624, 0, 1625, 0, 1626, 0, 1627, 0, 824, 0, 1628, 0, 1629, 0,
+        1630, 0, 1631, 0, 1632, 0, 1633, 0, 1634, 0, 1635, 0, 1636, 0, 1637, 0,
+        1638, 0, 1639, 0, 1640, 0, 1641, 0, 1642, 0, 1643, 0, 1644, 0, 0, 353,
+        0, 0, 0, 0, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 0, 0,
+        1645, 0, 1646, 0, 1647, 0, 1648, 0, 1649, 0, 1650, 0, 1651, 0, 1652, 0,
+        1653, 0, 1654, 0, 1655, 0, 1656, 0, 1657, 0, 1658, 0, 0, 0, 353, 353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1659, 0, 1660, 0, 1661, 0, 1662, 0, 1663, 0, 1664, 0, 1665, 0,
+        0, 0, 1666, 0, 1667, 0, 1668, 0, 1669, 0, 1670, 0, 1671, 0, 1672, 0,
+        1673, 0, 1674, 0, 1675, 0, 1676, 0, 1677, 0, 1678, 0, 1679, 0, 1680, 0,
+        1681, 0, 1682, 0, 1683, 0, 1684, 0, 1685, 0, 1686, 0, 1687, 0, 1688, 0,
+        1689, 0, 1690, 0, 1691, 0, 1692, 0, 1693, 0, 1694, 0, 1695, 0, 1696, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1697, 0, 1698, 0, 1699, 1700, 0,
+        1701, 0, 1702, 0, 1703, 0, 1704, 0, 0, 0, 0, 1705, 0, 1706, 0, 0,
+        1707, 0, 1708, 0, 0, 0, 1709, 0, 1710, 0, 1711, 0, 1712, 0, 1713, 0,
+        1714, 0, 1715, 0, 1716, 0, 1717, 0, 1718, 0, 1719, 1720, 1721, 1722, 1723, 0,
+        1724, 1725, 1726, 1727, 1728, 0, 1729, 0, 1730, 0, 1731, 0, 1732, 0, 1733, 0,
+        1734, 0, 1735, 0, 1736, 1737, 1738, 1739, 0, 1740, 0, 0, 0, 0, 0, 0,
+        1741, 0, 0, 0, 0, 0, 1742, 0, 1743, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353,
+        353, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 355, 355, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 0, 353, 353, 355, 0, 0, 353, 353, 0, 0, 0, 0, 0, 353, 353,
+        0, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760,
+        1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776,
+        1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792,
+        1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808,
+        1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825,
+        1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825,
+        1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825,
+        1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825,
+        1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825,
+        1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825,
+        1825, 1825, 1825, 1825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840,
+        1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856,
+        1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872,
+        1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888,
+        1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904,
+        1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1845, 1917, 1918, 1919,
+        1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+        1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+        1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
+        1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983,
+        1984, 1935, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1919, 1993, 1994, 1995, 1996, 1997,
+        1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 1845,
+        2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028,
+        2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 1921, 2040, 2041, 2042, 2043,
+        2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059,
+        2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075,
+        2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 0, 0,
+        2090, 0, 2091, 0, 0, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 0,
+        2102, 0, 2103, 0, 0, 2104, 2105, 0, 0, 0, 2106, 2107, 2108, 2109, 2110, 2111,
+        2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+        2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143,
+        2144, 2145, 2146, 2147, 2148, 2149, 2150, 1974, 2151, 2152, 2153, 2154, 2155, 2156, 2156, 2157,
+        2158, 2159, 2160, 2161, 2162, 2163, 2164, 2104, 2165, 2166, 2167, 2168, 2169, 2170, 0, 0,
+        2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2118, 2179, 2180, 2181, 2090, 2182, 2183, 2184,
+        2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2127, 2194, 2128, 2195, 2196, 2197, 2198,
+        2199, 2091, 1866, 2200, 2201, 2202, 1936, 2023, 2203, 2204, 2135, 2205, 2136, 2206, 2207, 2208,
+        2093, 2209, 2210, 2211, 2212, 2213, 2094, 2214, 2215, 2216, 2217, 2218, 2219, 2150, 2220, 2221,
+        1974, 2222, 2154, 2223, 2224, 2225, 2226, 2227, 2159, 2228, 2103, 2229, 2160, 1917, 2230, 2161,
+        2231, 2163, 2232, 2233, 2234, 2235, 2236, 2165, 2099, 2237, 2166, 2238, 2167, 2239, 1833, 2240,
+        2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2251, 2252, 2253, 2254, 2255, 2256, 2256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2257, 2258, 2259, 2260, 2261, 0, 0, 0, 0, 0, 2262, 2263, 2264,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2265, 2266, 2267, 2268, 2269, 2270,
+        2271, 2272, 2273, 2274, 2275, 2276, 2277, 0, 2278, 2279, 2280, 2281, 2282, 0, 2283, 0,
+        2284, 2285, 0, 2286, 2287, 0, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 353, 353, 353, 353, 353, 355, 355, 355, 355, 355, 355, 355, 353, 353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311,
+        2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        355, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 353, 353, 353, 353, 353, 0, 0, 0, 0, 0,
+        2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338,
+        2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354,
+        2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378,
+        2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394,
+        2395, 2396, 2397, 2398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 0, 2410, 2411, 2412, 2413,
+        2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 0, 2425, 2426, 2427, 2428,
+        2429, 2430, 2431, 0, 2432, 2433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0, 353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 353, 360, 355, 0, 0, 0, 0, 694,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 353, 355, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449,
+        2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465,
+        2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481,
+        2482, 2483, 2484, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 353, 353, 353, 353, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 353, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 355, 355, 353, 353, 353, 355, 353, 355, 355, 355,
+        355, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 353, 355, 353, 355, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2485, 0, 2486, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2487, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 693, 0, 0, 0, 0, 0,
+        353, 353, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 704, 0, 0, 0, 0, 0, 0, 2488, 2489,
+        0, 0, 0, 694, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 703, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 694, 703, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 703, 694, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 703, 703, 0, 704, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2490, 2491, 694, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 704, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 353, 353, 353, 353, 353, 353, 353, 0, 0, 0,
+        353, 353, 353, 353, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 694, 0, 0, 0, 703, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 704, 2492, 2493, 704, 2494, 0,
+        0, 0, 694, 703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 704,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2495, 2496, 0, 0, 0, 694,
+        703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 694, 703, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 703, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512,
+        2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        704, 0, 0, 0, 0, 0, 0, 0, 2529, 0, 0, 0, 0, 694, 694, 0,
+        0, 0, 0, 703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 703, 0, 694, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        360, 360, 360, 360, 360, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 353, 353, 353, 353, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545,
+        2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2562, 2562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 360, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2563, 2564,
+        2565, 2566, 2567, 2568, 2569, 745, 745, 360, 360, 360, 0, 0, 0, 2570, 745, 745,
+        745, 745, 745, 0, 0, 0, 0, 0, 0, 0, 0, 355, 355, 355, 355, 355,
+        355, 355, 355, 0, 0, 353, 353, 353, 353, 353, 355, 355, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 353, 353, 353, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2571, 2572, 2573, 2574, 2575,
+        2576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 353, 353, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 353, 353, 353, 353, 353, 353, 0, 353, 353, 353, 353, 353, 353, 353, 353,
+        353, 353, 353, 353, 353, 353, 353, 353, 353, 0, 0, 353, 353, 353, 353, 353,
+        353, 353, 0, 353, 353, 0, 353, 353, 353, 353, 353, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 353, 353, 353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        355, 355, 355, 355, 355, 355, 355, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592,
+        2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608,
+        2609, 2610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 353, 353, 353, 353, 353, 353, 703, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2611, 2612, 2613, 2614, 2615, 2112, 2616, 2617, 2618, 2619, 2113, 2620, 2621, 2622, 2114, 2623,
+        2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2172, 2635, 2636, 2637, 2638,
+        2639, 2640, 2641, 2642, 2643, 2177, 2115, 2116, 2178, 2644, 2645, 1923, 2646, 2117, 2647, 2648,
+        2649, 2650, 2650, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662,
+        2663, 2664, 2665, 2666, 2667, 2668, 2668, 2180, 2669, 2670, 2671, 2672, 2119, 2673, 2674, 2675,
+        2076, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690,
+        2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2701, 2702, 2703, 2704, 1919,
+        2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2124, 2713, 2714, 2715, 2716, 2717, 2718, 2719,
+        2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 1865, 2734,
+        2735, 2736, 2736, 2737, 2738, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748,
+        2749, 2750, 2751, 2125, 2752, 2753, 2754, 2755, 2192, 2755, 2756, 2127, 2757, 2758, 2759, 2760,
+        2128, 1838, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774,
+        2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2129, 2783, 2784, 2785, 2786, 2787, 2788, 2131,
+        2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 1866, 2200, 2797, 2798, 2799, 2800, 2801, 2802,
+        2803, 2804, 2132, 2805, 2806, 2807, 2808, 2243, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816,
+        2817, 2818, 2819, 2820, 2821, 1936, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831,
+        2832, 2133, 2023, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2204, 2841, 2842, 2843, 2844,
+        2845, 2846, 2847, 2848, 2205, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859,
+        2860, 2207, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2871, 2872, 2873,
+        2209, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 1922, 2881, 2882, 2883, 2884, 2885, 2886, 2887,
+        2215, 2888, 2889, 2890, 2891, 2892, 2893, 2893, 2216, 2245, 2894, 2895, 2896, 2897, 2898, 1884,
+        2218, 2899, 2900, 2144, 2901, 2902, 2098, 2903, 2904, 2148, 2905, 2906, 2907, 2908, 2908, 2909,
+        2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925,
+        2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2154, 2936, 2937, 2938, 2939, 2940,
+        2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2737, 2952, 2953, 2954, 2955,
+        2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 1940, 2964, 2965, 2966, 2967, 2968, 2969, 2157,
+        2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985,
+        2986, 2987, 2988, 2989, 1879, 2990, 2991, 2992, 2993, 2994, 2995, 2225, 2996, 2997, 2998, 2999,
+        3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015,
+        2230, 2231, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 2232,
+        3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044,
+        3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 2238, 2238,
+        3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 2239, 3069, 3070, 3071, 3072, 3073,
+        3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* Canonical combining class and flags, offset of the full canonical decomposition in utf8c_norm_data
+ * and offset of the full case folding in it. Offset 0 means there's none*/
+static const unsigned short utf8c_norm_records[3088][3] = {
+        {0, 0, 0}, {2048, 0, 1}, {2048, 0, 3}, {2048, 0, 5}, {2048, 0, 7}, {2048, 0, 9},
+        {2048, 0, 11}, {2048, 0, 13}, {2048, 0, 15}, {2048, 0, 17}, {2048, 0, 19}, {2048, 0, 21},
+        {2048, 0, 23}, {2048, 0, 25}, {2048, 0, 27}, {2048, 0, 29}, {2048, 0, 31}, {2048, 0, 33},
+        {2048, 0, 35}, {2048, 0, 37}, {2048, 0, 39}, {2048, 0, 41}, {2048, 0, 43}, {2048, 0, 45},
+        {2048, 0, 47}, {2048, 0, 49}, {2048, 0, 51}, {2048, 0, 53}, {2304, 55, 58}, {2304, 60, 63},
+        {2304, 65, 68}, {2304, 70, 73}, {2304, 75, 78}, {2304, 80, 83}, {2048, 0, 85}, {2304, 87, 90},
+        {2304, 92, 95}, {2304, 97, 100}, {2304, 102, 105}, {2304, 107, 110}, {2304, 112, 115}, {2304, 117, 120},
+        {2304, 122, 125}, {2304, 127, 130}, {2048, 0, 132}, {2304, 134, 137}, {2304, 139, 142}, {2304, 144, 147},
+        {2304, 149, 152}, {2304, 154, 157}, {2304, 159, 162}, {2048, 0, 164}, {2304, 166, 169}, {2304, 171, 174},
+        {2304, 176, 179}, {2304, 181, 184}, {2304, 186, 189}, {2048, 0, 191}, {2048, 0, 193}, {256, 196, 0},
+        {256, 199, 0}, {256, 202, 0}, {256, 205, 0}, {256, 208, 0}, {256, 211, 0}, {256, 214, 0},
+        {256, 217, 0}, {256, 220, 0}, {256, 223, 0}, {256, 226, 0}, {256, 229, 0}, {256, 232, 0},
+        {256, 235, 0}, {256, 238, 0}, {256, 241, 0}, {256, 244, 0}, {256, 247, 0}, {256, 250, 0},
+        {256, 253, 0}, {256, 256, 0}, {256, 259, 0}, {256, 262, 0}, {256, 265, 0}, {256, 268, 0},
+        {256, 271, 0}, {256, 274, 0}, {2304, 277, 280}, {256, 282, 0}, {2304, 285, 288}, {256, 290, 0},
+        {2304, 293, 296}, {256, 298, 0}, {2304, 301, 304}, {256, 306, 0}, {2304, 309, 312}, {256, 314, 0},
+        {2304, 317, 320}, {256, 322, 0}, {2304, 325, 328}, {256, 330, 0}, {2304, 333, 336}, {256, 338, 0},
+        {2048, 0, 341}, {2304, 343, 346}, {256, 348, 0}, {2304, 351, 354}, {256, 356, 0}, {2304, 359, 362},
+        {256, 364, 0}, {2304, 367, 370}, {256, 372, 0}, {2304, 375, 378}, {256, 380, 0}, {2304, 383, 386},
+        {256, 388, 0}, {2304, 391, 394}, {256, 396, 0}, {2304, 399, 402}, {256, 404, 0}, {2304, 407, 410},
+        {256, 412, 0}, {2304, 415, 418}, {256, 420, 0}, {2048, 0, 423}, {2304, 425, 428}, {256, 430, 0},
+        {2304, 433, 436}, {256, 438, 0}, {2304, 441, 444}, {256, 446, 0}, {2304, 449, 452}, {256, 454, 0},
+        {2304, 457, 460}, {2048, 0, 463}, {2304, 465, 468}, {256, 470, 0}, {2304, 473, 476}, {256, 478, 0},
+        {2304, 481, 484}, {256, 486, 0}, {2304, 489, 492}, {256, 494, 0}, {2304, 497, 500}, {256, 502, 0},
+        {2048, 0, 505}, {2048, 0, 507}, {2304, 509, 512}, {256, 514, 0}, {2304, 517, 520}, {256, 522, 0},
+        {2304, 525, 528}, {256, 530, 0}, {2048, 0, 533}, {2048, 0, 536}, {2304, 538, 541}, {256, 543, 0},
+        {2304, 546, 549}, {256, 551, 0}, {2304, 554, 557}, {256, 559, 0}, {2048, 0, 562}, {2304, 564, 567},
+        {256, 569, 0}, {2304, 572, 575}, {256, 577, 0}, {2304, 580, 583}, {256, 585, 0}, {2304, 588, 591},
+        {256, 593, 0}, {2304, 596, 599}, {256, 601, 0}, {2304, 604, 607}, {256, 609, 0}, {2304, 612, 615},
+        {256, 617, 0}, {2304, 620, 623}, {256, 625, 0}, {2304, 628, 631}, {256, 633, 0}, {2048, 0, 636},
+        {2304, 638, 641}, {256, 643, 0}, {2304, 646, 649}, {256, 651, 0}, {2304, 654, 657}, {256, 659, 0},
+        {2304, 662, 665}, {256, 667, 0}, {2304, 670, 673}, {256, 675, 0}, {2304, 678, 681}, {256, 683, 0},
+        {2304, 686, 689}, {256, 691, 0}, {2304, 694, 697}, {256, 699, 0}, {2304, 702, 705}, {2304, 707, 710},
+        {256, 712, 0}, {2304, 715, 718}, {256, 720, 0}, {2304, 723, 726}, {256, 728, 0}, {2048, 0, 731},
+        {2048, 0, 733}, {2048, 0, 735}, {2048, 0, 737}, {2048, 0, 739}, {2048, 0, 741}, {2048, 0, 743},
+        {2048, 0, 745}, {2048, 0, 747}, {2048, 0, 749}, {2048, 0, 751}, {2048, 0, 753}, {2048, 0, 755},
+        {2048, 0, 757}, {2048, 0, 759}, {2048, 0, 761}, {2048, 0, 763}, {2048, 0, 765}, {2048, 0, 767},
+        {2048, 0, 769}, {2304, 771, 774}, {256, 776, 0}, {2048, 0, 779}, {2048, 0, 781}, {2048, 0, 783},
+        {2048, 0, 785}, {2048, 0, 787}, {2048, 0, 789}, {2048, 0, 791}, {2304, 793, 796}, {256, 798, 0},
+        {2048, 0, 801}, {2048, 0, 803}, {2048, 0, 805}, {2048, 0, 807}, {2048, 0, 809}, {2048, 0, 811},
+        {2048, 0, 813}, {2048, 0, 815}, {2048, 0, 817}, {2048, 0, 819}, {2304, 821, 824}, {256, 826, 0},
+        {2304, 829, 832}, {256, 834, 0}, {2304, 837, 840}, {256, 842, 0}, {2304, 845, 848}, {256, 850, 0},
+        {2304, 853, 857}, {256, 859, 0}, {2304, 863, 867}, {256, 869, 0}, {2304, 873, 877}, {256, 879, 0},
+        {2304, 883, 887}, {256, 889, 0}, {2304, 893, 897}, {256, 899, 0}, {2304, 903, 907}, {256, 909, 0},
+        {2304, 913, 916}, {256, 918, 0}, {2048, 0, 921}, {2304, 923, 926}, {256, 928, 0}, {2304, 931, 934},
+        {256, 936, 0}, {2304, 939, 942}, {256, 944, 0}, {2304, 947, 951}, {256, 953, 0}, {2304, 957, 960},
+        {256, 962, 0}, {2304, 965, 965}, {2048, 0, 968}, {2304, 970, 973}, {256, 975, 0}, {2048, 0, 978},
+        {2048, 0, 980}, {2304, 982, 985}, {256, 987, 0}, {2304, 990, 994}, {256, 996, 0}, {2304, 1000, 1003},
+        {256, 1005, 0}, {2304, 1008, 1011}, {256, 1013, 0}, {2304, 1016, 1019}, {256, 1021, 0}, {2304, 1024, 1027},
+        {256, 1029, 0}, {2304, 1032, 1035}, {256, 1037, 0}, {2304, 1040, 1043}, {256, 1045, 0}, {2304, 1048, 1051},
+        {256, 1053, 0}, {2304, 1056, 1059}, {256, 1061, 0}, {2304, 1064, 1067}, {256, 1069, 0}, {2304, 1072, 1075},
+        {256, 1077, 0}, {2304, 1080, 1083}, {256, 1085, 0}, {2304, 1088, 1091}, {256, 1093, 0}, {2304, 1096, 1099},
+        {256, 1101, 0}, {2304, 1104, 1107}, {256, 1109, 0}, {2304, 1112, 1115}, {256, 1117, 0}, {2304, 1120, 1123},
+        {256, 1125, 0}, {2048, 0, 1128}, {2304, 1130, 1133}, {256, 1135, 0}, {2048, 0, 1138}, {2048, 0, 1140},
+        {2048, 0, 1142}, {2304, 1144, 1147}, {256, 1149, 0}, {2304, 1152, 1155}, {256, 1157, 0}, {2304, 1160, 1164},
+        {256, 1166, 0}, {2304, 1170, 1174}, {256, 1176, 0}, {2304, 1180, 1183}, {256, 1185, 0}, {2304, 1188, 1192},
+        {256, 1194, 0}, {2304, 1198, 1201}, {256, 1203, 0}, {2048, 0, 1206}, {2048, 0, 1208}, {2048, 0, 1210},
+        {2048, 0, 1212}, {2048, 0, 1214}, {2048, 0, 1216}, {2048, 0, 1218}, {2048, 0, 1220}, {2048, 0, 1222},
+        {2048, 0, 1224}, {2048, 0, 1226}, {2048, 0, 1228}, {2048, 0, 1230}, {1254, 0, 0}, {230, 0, 0},
+        {232, 0, 0}, {220, 0, 0}, {1240, 0, 0}, {202, 0, 0}, {1244, 0, 0}, {1226, 0, 0},
+        {1, 0, 0}, {1025, 0, 0}, {998, 1232, 0}, {998, 1234, 0}, {998, 1236, 0}, {998, 1238, 0},
+        {3312, 0, 1241}, {233, 0, 0}, {234, 0, 0}, {2048, 0, 1243}, {2048, 0, 1245}, {768, 1247, 0},
+        {2048, 0, 1249}, {768, 1251, 0}, {2048, 0, 1253}, {256, 1255, 0}, {2304, 1258, 1261}, {768, 1263, 0},
+        {2304, 1265, 1268}, {2304, 1270, 1273}, {2304, 1275, 1278}, {2304, 1280, 1283}, {2304, 1285, 1288}, {2304, 1290, 1293},
+        {2304, 1295, 1295}, {2048, 0, 1299}, {2048, 0, 1301}, {2048, 0, 1303}, {2048, 0, 1305}, {2048, 0, 1307},
+        {2048, 0, 1309}, {2048, 0, 1311}, {2048, 0, 1313}, {2048, 0, 1241}, {2048, 0, 1315}, {2048, 0, 1317},
+        {2048, 0, 1319}, {2048, 0, 1321}, {2048, 0, 1323}, {2048, 0, 1325}, {2048, 0, 1327}, {2048, 0, 1329},
+        {2048, 0, 1331}, {2048, 0, 1333}, {2048, 0, 1335}, {2048, 0, 1337}, {2048, 0, 1339}, {2048, 0, 1341},
+        {2304, 1343, 1346}, {2304, 1348, 1351}, {256, 1353, 0}, {256, 1356, 0}, {256, 1359, 0}, {256, 1362, 0},
+        {2304, 1365, 1365}, {256, 1369, 0}, {256, 1372, 0}, {256, 1375, 0}, {256, 1378, 0}, {256, 1381, 0},
+        {2048, 0, 1384}, {256, 1386, 0}, {256, 1389, 0}, {2048, 0, 1392}, {2048, 0, 1394}, {2048, 0, 1396},
+        {2048, 0, 1398}, {2048, 0, 1400}, {2048, 0, 1402}, {2048, 0, 1404}, {2048, 0, 1406}, {2048, 0, 1408},
+        {2048, 0, 1410}, {2048, 0, 1412}, {2048, 0, 1414}, {2048, 0, 1416}, {2048, 0, 1418}, {2048, 0, 1420},
+        {2048, 0, 1422}, {2048, 0, 1424}, {2048, 0, 1426}, {2304, 1428, 1431}, {2304, 1433, 1436}, {2048, 0, 1438},
+        {2304, 1440, 1443}, {2048, 0, 1445}, {2048, 0, 1447}, {2048, 0, 1449}, {2304, 1451, 1454}, {2048, 0, 1456},
+        {2048, 0, 1458}, {2048, 0, 1460}, {2048, 0, 1462}, {2304, 1464, 1467}, {2304, 1469, 1472}, {2304, 1474, 1477},
+        {2048, 0, 1479}, {2048, 0, 1481}, {2048, 0, 1483}, {2048, 0, 1485}, {2048, 0, 1487}, {2048, 0, 1489},
+        {2048, 0, 1491}, {2048, 0, 1493}, {2048, 0, 1495}, {2048, 0, 1497}, {2304, 1499, 1502}, {2048, 0, 1504},
+        {2048, 0, 1506}, {2048, 0, 1508}, {2048, 0, 1510}, {2048, 0, 1512}, {2048, 0, 1514}, {2048, 0, 1516},
+        {2048, 0, 1518}, {2048, 0, 1520}, {2048, 0, 1522}, {2048, 0, 1524}, {2048, 0, 1526}, {2048, 0, 1528},
+        {2048, 0, 1530}, {2048, 0, 1532}, {2048, 0, 1534}, {2048, 0, 1536}, {2048, 0, 1538}, {2048, 0, 1540},
+        {2048, 0, 1542}, {2048, 0, 1544}, {2048, 0, 1546}, {256, 1548, 0}, {256, 1551, 0}, {256, 1554, 0},
+        {256, 1557, 0}, {256, 1560, 0}, {256, 1563, 0}, {256, 1566, 0}, {256, 1569, 0}, {2048, 0, 1572},
+        {2048, 0, 1574}, {2048, 0, 1576}, {2048, 0, 1578}, {2048, 0, 1580}, {2048, 0, 1582}, {2048, 0, 1584},
+        {2048, 0, 1586}, {2048, 0, 1588}, {2048, 0, 1590}, {2048, 0, 1592}, {2304, 1594, 1597}, {256, 1599, 0},
+        {2048, 0, 1602}, {2048, 0, 1604}, {2048, 0, 1606}, {2048, 0, 1608}, {2048, 0, 1610}, {2048, 0, 1612},
+        {2048, 0, 1614}, {2048, 0, 1616}, {2048, 0, 1618}, {2048, 0, 1620}, {2048, 0, 1622}, {2048, 0, 1624},
+        {2048, 0, 1626}, {2048, 0, 1628}, {2048, 0, 1630}, {2048, 0, 1632}, {2048, 0, 1634}, {2048, 0, 1636},
+        {2048, 0, 1638}, {2048, 0, 1640}, {2048, 0, 1642}, {2048, 0, 1644}, {2048, 0, 1646}, {2048, 0, 1648},
+        {2048, 0, 1650}, {2048, 0, 1652}, {2048, 0, 1654}, {2048, 0, 1656}, {2048, 0, 1658}, {2048, 0, 1660},
+        {2048, 0, 1662}, {2048, 0, 1664}, {2048, 0, 1666}, {2304, 1668, 1671}, {256, 1673, 0}, {2048, 0, 1676},
+        {2048, 0, 1678}, {2048, 0, 1680}, {2048, 0, 1682}, {2048, 0, 1684}, {2048, 0, 1686}, {2304, 1688, 1691},
+        {256, 1693, 0}, {2304, 1696, 1699}, {256, 1701, 0}, {2048, 0, 1704}, {2304, 1706, 1709}, {256, 1711, 0},
+        {2048, 0, 1714}, {2304, 1716, 1719}, {256, 1721, 0}, {2304, 1724, 1727}, {256, 1729, 0}, {2304, 1732, 1735},
+        {256, 1737, 0}, {2048, 0, 1740}, {2304, 1742, 1745}, {256, 1747, 0}, {2304, 1750, 1753}, {256, 1755, 0},
+        {2304, 1758, 1761}, {256, 1763, 0}, {2048, 0, 1766}, {2304, 1768, 1771}, {256, 1773, 0}, {2304, 1776, 1779},
+        {256, 1781, 0}, {2304, 1784, 1787}, {256, 1789, 0}, {2304, 1792, 1795}, {256, 1797, 0}, {2304, 1800, 1803},
+        {256, 1805, 0}, {2304, 1808, 1811}, {256, 1813, 0}, {2048, 0, 1816}, {2304, 1818, 1821}, {256, 1823, 0},
+        {2048, 0, 1826}, {2048, 0, 1828}, {2048, 0, 1830}, {2048, 0, 1832}, {2048, 0, 1834}, {2048, 0, 1836},
+        {2048, 0, 1838}, {2048, 0, 1840}, {2048, 0, 1842}, {2048, 0, 1844}, {2048, 0, 1846}, {2048, 0, 1848},
+        {2048, 0, 1850}, {2048, 0, 1852}, {2048, 0, 1854}, {2048, 0, 1856}, {2048, 0, 1858}, {2048, 0, 1860},
+        {2048, 0, 1862}, {2048, 0, 1864}, {2048, 0, 1866}, {2048, 0, 1868}, {2048, 0, 1870}, {2048, 0, 1872},
+        {2048, 0, 1874}, {2048, 0, 1876}, {2048, 0, 1878}, {2048, 0, 1880}, {2048, 0, 1882}, {2048, 0, 1884},
+        {2048, 0, 1886}, {2048, 0, 1888}, {2048, 0, 1890}, {2048, 0, 1892}, {2048, 0, 1894}, {2048, 0, 1896},
+        {2048, 0, 1898}, {2048, 0, 1900}, {2048, 0, 1902}, {2048, 0, 1904}, {2048, 0, 1906}, {2048, 0, 1908},
+        {2048, 0, 1910}, {2048, 0, 1912}, {2048, 0, 1914}, {2048, 0, 1916}, {2048, 0, 1918}, {2048, 0, 1920},
+        {2048, 0, 1922}, {2048, 0, 1924}, {2048, 0, 1926}, {2048, 0, 1928}, {2048, 0, 1930}, {2048, 0, 1932},
+        {2048, 0, 1934}, {2048, 0, 1936}, {2048, 0, 1938}, {2048, 0, 1940}, {2048, 0, 1942}, {2048, 0, 1944},
+        {2048, 0, 1946}, {2048, 0, 1948}, {2048, 0, 1950}, {2048, 0, 1952}, {2048, 0, 1954}, {2048, 0, 1956},
+        {222, 0, 0}, {228, 0, 0}, {10, 0, 0}, {11, 0, 0}, {12, 0, 0}, {13, 0, 0},
+        {14, 0, 0}, {15, 0, 0}, {16, 0, 0}, {17, 0, 0}, {18, 0, 0}, {19, 0, 0},
+        {20, 0, 0}, {21, 0, 0}, {22, 0, 0}, {23, 0, 0}, {24, 0, 0}, {25, 0, 0},
+        {30, 0, 0}, {31, 0, 0}, {32, 0, 0}, {256, 1959, 0}, {256, 1962, 0}, {256, 1965, 0},
+        {256, 1968, 0}, {256, 1971, 0}, {27, 0, 0}, {28, 0, 0}, {29, 0, 0}, {33, 0, 0},
+        {34, 0, 0}, {35, 0, 0}, {256, 1974, 0}, {256, 1977, 0}, {256, 1980, 0}, {36, 0, 0},
+        {256, 1983, 0}, {256, 1986, 0}, {256, 1989, 0}, {1031, 0, 0}, {9, 0, 0}, {768, 1992, 0},
+        {768, 1995, 0}, {768, 1998, 0}, {768, 2001, 0}, {768, 2004, 0}, {768, 2007, 0}, {768, 2010, 0},
+        {768, 2013, 0}, {7, 0, 0}, {1024, 0, 0}, {256, 2016, 0}, {256, 2019, 0}, {768, 2022, 0},
+        {768, 2025, 0}, {768, 2028, 0}, {768, 2031, 0}, {768, 2034, 0}, {768, 2037, 0}, {768, 2040, 0},
+        {768, 2043, 0}, {768, 2046, 0}, {256, 2049, 0}, {256, 2052, 0}, {256, 2055, 0}, {768, 2058, 0},
+        {768, 2061, 0}, {256, 2064, 0}, {256, 2067, 0}, {256, 2070, 0}, {256, 2073, 0}, {256, 2076, 0},
+        {84, 0, 0}, {1115, 0, 0}, {256, 2079, 0}, {256, 2082, 0}, {256, 2085, 0}, {256, 2088, 0},
+        {256, 2091, 0}, {256, 2095, 0}, {256, 2098, 0}, {256, 2101, 0}, {1033, 0, 0}, {256, 2104, 0},
+        {256, 2107, 0}, {256, 2110, 0}, {256, 2114, 0}, {103, 0, 0}, {107, 0, 0}, {118, 0, 0},
+        {122, 0, 0}, {216, 0, 0}, {768, 2117, 0}, {768, 2120, 0}, {768, 2123, 0}, {768, 2126, 0},
+        {768, 2129, 0}, {768, 2132, 0}, {129, 0, 0}, {130, 0, 0}, {768, 2135, 0}, {132, 0, 0},
+        {768, 2138, 0}, {768, 2141, 0}, {768, 2144, 0}, {768, 2147, 0}, {768, 2150, 0}, {768, 2153, 0},
+        {768, 2156, 0}, {768, 2159, 0}, {768, 2162, 0}, {768, 2165, 0}, {256, 2168, 0}, {2048, 0, 2171},
+        {2048, 0, 2173}, {2048, 0, 2175}, {2048, 0, 2177}, {2048, 0, 2179}, {2048, 0, 2181}, {2048, 0, 2183},
+        {2048, 0, 2185}, {2048, 0, 2187}, {2048, 0, 2189}, {2048, 0, 2191}, {2048, 0, 2193}, {2048, 0, 2195},
+        {2048, 0, 2197}, {2048, 0, 2199}, {2048, 0, 2201}, {2048, 0, 2203}, {2048, 0, 2205}, {2048, 0, 2207},
+        {2048, 0, 2209}, {2048, 0, 2211}, {2048, 0, 2213}, {2048, 0, 2215}, {2048, 0, 2217}, {2048, 0, 2219},
+        {2048, 0, 2221}, {2048, 0, 2223}, {2048, 0, 2225}, {2048, 0, 2227}, {2048, 0, 2229}, {2048, 0, 2231},
+        {2048, 0, 2233}, {2048, 0, 2235}, {2048, 0, 2237}, {2048, 0, 2239}, {2048, 0, 2241}, {2048, 0, 2243},
+        {2048, 0, 2245}, {2048, 0, 2247}, {2048, 0, 2249}, {2048, 0, 2251}, {2048, 0, 2253}, {2048, 0, 2255},
+        {2048, 0, 2257}, {2048, 0, 2259}, {2048, 0, 2261}, {256, 2263, 0}, {256, 2266, 0}, {256, 2269, 0},
+        {256, 2272, 0}, {256, 2275, 0}, {256, 2278, 0}, {256, 2281, 0}, {256, 2284, 0}, {256, 2287, 0},
+        {256, 2290, 0}, {256, 2293, 0}, {2048, 0, 2296}, {2048, 0, 2298}, {2048, 0, 2300}, {2048, 0, 2302},
+        {2048, 0, 2304}, {2048, 0, 2306}, {2048, 0, 2308}, {2048, 0, 2310}, {2048, 0, 2312}, {2048, 0, 2314},
+        {2048, 0, 2316}, {2048, 0, 2318}, {2048, 0, 2320}, {2048, 0, 2322}, {2048, 0, 2324}, {2048, 0, 2326},
+        {2048, 0, 2328}, {2048, 0, 2330}, {2048, 0, 2332}, {2048, 0, 2334}, {2048, 0, 2336}, {2048, 0, 2338},
+        {2048, 0, 2340}, {2048, 0, 2342}, {2048, 0, 2344}, {2048, 0, 2346}, {2048, 0, 2348}, {2048, 0, 2350},
+        {2048, 0, 2352}, {2048, 0, 2354}, {2048, 0, 2356}, {2048, 0, 2358}, {2048, 0, 2360}, {2048, 0, 2362},
+        {2048, 0, 2364}, {2048, 0, 2366}, {2048, 0, 2368}, {2048, 0, 2370}, {2048, 0, 2372}, {2048, 0, 2374},
+        {2048, 0, 2376}, {2048, 0, 2378}, {2048, 0, 2380}, {2048, 0, 2382}, {2048, 0, 2384}, {2048, 0, 2386},
+        {2048, 0, 2388}, {214, 0, 0}, {218, 0, 0}, {2304, 2390, 2393}, {256, 2395, 0}, {2304, 2398, 2401},
+        {256, 2403, 0}, {2304, 2406, 2409}, {256, 2411, 0}, {2304, 2414, 2417}, {256, 2419, 0}, {2304, 2422, 2426},
+        {256, 2428, 0}, {2304, 2432, 2435}, {256, 2437, 0}, {2304, 2440, 2443}, {256, 2445, 0}, {2304, 2448, 2451},
+        {256, 2453, 0}, {2304, 2456, 2459}, {256, 2461, 0}, {2304, 2464, 2467}, {256, 2469, 0}, {2304, 2472, 2476},
+        {256, 2478, 0}, {2304, 2482, 2486}, {256, 2488, 0}, {2304, 2492, 2495}, {256, 2497, 0}, {2304, 2500, 2503},
+        {256, 2505, 0}, {2304, 2508, 2512}, {256, 2514, 0}, {2304, 2518, 2521}, {256, 2523, 0}, {2304, 2526, 2529},
+        {256, 2531, 0}, {2304, 2534, 2537}, {256, 2539, 0}, {2304, 2542, 2545}, {256, 2547, 0}, {2304, 2550, 2553},
+        {256, 2555, 0}, {2304, 2558, 2561}, {256, 2563, 0}, {2304, 2566, 2569}, {256, 2571, 0}, {2304, 2574, 2577},
+        {256, 2579, 0}, {2304, 2582, 2586}, {256, 2588, 0}, {2304, 2592, 2595}, {256, 2597, 0}, {2304, 2600, 2603},
+        {256, 2605, 0}, {2304, 2608, 2611}, {256, 2613, 0}, {2304, 2616, 2619}, {256, 2621, 0}, {2304, 2624, 2628},
+        {256, 2630, 0}, {2304, 2634, 2637}, {256, 2639, 0}, {2304, 2642, 2645}, {256, 2647, 0}, {2304, 2650, 2653},
+        {256, 2655, 0}, {2304, 2658, 2661}, {256, 2663, 0}, {2304, 2666, 2669}, {256, 2671, 0}, {2304, 2674, 2677},
+        {256, 2679, 0}, {2304, 2682, 2685}, {256, 2687, 0}, {2304, 2690, 2693}, {256, 2695, 0}, {2304, 2698, 2701},
+        {256, 2703, 0}, {2304, 2706, 2710}, {256, 2712, 0}, {2304, 2716, 2720}, {256, 2722, 0}, {2304, 2726, 2730},
+        {256, 2732, 0}, {2304, 2736, 2740}, {256, 2742, 0}, {2304, 2746, 2749}, {256, 2751, 0}, {2304, 2754, 2757},
+        {256, 2759, 0}, {2304, 2762, 2765}, {256, 2767, 0}, {2304, 2770, 2773}, {256, 2775, 0}, {2304, 2778, 2782},
+        {256, 2784, 0}, {2304, 2788, 2791}, {256, 2793, 0}, {2304, 2796, 2799}, {256, 2801, 0}, {2304, 2804, 2807},
+        {256, 2809, 0}, {2304, 2812, 2816}, {256, 2818, 0}, {2304, 2822, 2826}, {256, 2828, 0}, {2304, 2832, 2836},
+        {256, 2838, 0}, {2304, 2842, 2845}, {256, 2847, 0}, {2304, 2850, 2853}, {256, 2855, 0}, {2304, 2858, 2861},
+        {256, 2863, 0}, {2304, 2866, 2869}, {256, 2871, 0}, {2304, 2874, 2877}, {256, 2879, 0}, {2304, 2882, 2885},
+        {256, 2887, 0}, {2304, 2890, 2893}, {256, 2895, 0}, {2304, 2898, 2902}, {256, 2904, 0}, {2304, 2908, 2912},
+        {256, 2914, 0}, {2304, 2918, 2921}, {256, 2923, 0}, {2304, 2926, 2929}, {256, 2931, 0}, {2304, 2934, 2937},
+        {256, 2939, 0}, {2304, 2942, 2945}, {256, 2947, 0}, {2304, 2950, 2953}, {256, 2955, 0}, {2304, 2958, 2961},
+        {256, 2963, 0}, {2304, 2966, 2969}, {256, 2971, 0}, {2304, 2974, 2977}, {256, 2979, 0}, {2304, 2982, 2985},
+        {256, 2987, 0}, {2304, 2990, 2993}, {256, 2995, 0}, {2304, 2998, 3001}, {256, 3003, 0}, {2304, 3006, 3009},
+        {256, 3011, 0}, {2304, 3014, 3017}, {256, 3019, 0}, {2304, 3022, 3022}, {2304, 3025, 3025}, {2304, 3028, 3028},
+        {2304, 3031, 3031}, {2048, 0, 3034}, {2304, 3037, 2799}, {2304, 3040, 3043}, {256, 3045, 0}, {2304, 3048, 3051},
+        {256, 3053, 0}, {2304, 3056, 3060}, {256, 3062, 0}, {2304, 3066, 3070}, {256, 3072, 0}, {2304, 3076, 3080},
+        {256, 3082, 0}, {2304, 3086, 3090}, {256, 3092, 0}, {2304, 3096, 3100}, {256, 3102, 0}, {2304, 3106, 3110},
+        {256, 3112, 0}, {2304, 3116, 3120}, {256, 3122, 0}, {2304, 3126, 3130}, {256, 3132, 0}, {2304, 3136, 3140},
+        {256, 3142, 0}, {2304, 3146, 3150}, {256, 3152, 0}, {2304, 3156, 3159}, {256, 3161, 0}, {2304, 3164, 3167},
+        {256, 3169, 0}, {2304, 3172, 3175}, {256, 3177, 0}, {2304, 3180, 3184}, {256, 3186, 0}, {2304, 3190, 3194},
+        {256, 3196, 0}, {2304, 3200, 3204}, {256, 3206, 0}, {2304, 3210, 3214}, {256, 3216, 0}, {2304, 3220, 3224},
+        {256, 3226, 0}, {2304, 3230, 3233}, {256, 3235, 0}, {2304, 3238, 3241}, {256, 3243, 0}, {2304, 3246, 3249},
+        {256, 3251, 0}, {2304, 3254, 3257}, {256, 3259, 0}, {2304, 3262, 3266}, {256, 3268, 0}, {2304, 3272, 3276},
+        {256, 3278, 0}, {2304, 3282, 3286}, {256, 3288, 0}, {2304, 3292, 3296}, {256, 3298, 0}, {2304, 3302, 3306},
+        {256, 3308, 0}, {2304, 3312, 3316}, {256, 3318, 0}, {2304, 3322, 3326}, {256, 3328, 0}, {2304, 3332, 3336},
+        {256, 3338, 0}, {2304, 3342, 3346}, {256, 3348, 0}, {2304, 3352, 3356}, {256, 3358, 0}, {2304, 3362, 3365},
+        {256, 3367, 0}, {2304, 3370, 3373}, {256, 3375, 0}, {2304, 3378, 3382}, {256, 3384, 0}, {2304, 3388, 3392},
+        {256, 3394, 0}, {2304, 3398, 3402}, {256, 3404, 0}, {2304, 3408, 3412}, {256, 3414, 0}, {2304, 3418, 3422},
+        {256, 3424, 0}, {2304, 3428, 3431}, {256, 3433, 0}, {2304, 3436, 3439}, {256, 3441, 0}, {2304, 3444, 3447},
+        {256, 3449, 0}, {2304, 3452, 3455}, {256, 3457, 0}, {2048, 0, 3460}, {2048, 0, 3462}, {2048, 0, 3464},
+        {256, 3466, 0}, {256, 3469, 0}, {256, 3472, 0}, {256, 3476, 0}, {256, 3480, 0}, {256, 3484, 0},
+        {256, 3488, 0}, {256, 3492, 0}, {2304, 3496, 3499}, {2304, 3501, 3504}, {2304, 3506, 3510}, {2304, 3512, 3516},
+        {2304, 3518, 3522}, {2304, 3524, 3528}, {2304, 3530, 3534}, {2304, 3536, 3540}, {256, 3542, 0}, {256, 3545, 0},
+        {256, 3548, 0}, {256, 3552, 0}, {256, 3556, 0}, {256, 3560, 0}, {2304, 3564, 3567}, {2304, 3569, 3572},
+        {2304, 3574, 3578}, {2304, 3580, 3584}, {2304, 3586, 3590}, {2304, 3592, 3596}, {256, 3598, 0}, {256, 3601, 0},
+        {256, 3604, 0}, {256, 3608, 0}, {256, 3612, 0}, {256, 3616, 0}, {256, 3620, 0}, {256, 3624, 0},
+        {2304, 3628, 3631}, {2304, 3633, 3636}, {2304, 3638, 3642}, {2304, 3644, 3648}, {2304, 3650, 3654}, {2304, 3656, 3660},
+        {2304, 3662, 3666}, {2304, 3668, 3672}, {256, 3674, 0}, {256, 3677, 0}, {256, 3680, 0}, {256, 3684, 0},
+        {256, 3688, 0}, {256, 3692, 0}, {256, 3696, 0}, {256, 3700, 0}, {2304, 3704, 3707}, {2304, 3709, 3712},
+        {2304, 3714, 3718}, {2304, 3720, 3724}, {2304, 3726, 3730}, {2304, 3732, 3736}, {2304, 3738, 3742}, {2304, 3744, 3748},
+        {256, 3750, 0}, {256, 3753, 0}, {256, 3756, 0}, {256, 3760, 0}, {256, 3764, 0}, {256, 3768, 0},
+        {2304, 3772, 3775}, {2304, 3777, 3780}, {2304, 3782, 3786}, {2304, 3788, 3792}, {2304, 3794, 3798}, {2304, 3800, 3804},
+        {2304, 3806, 3806}, {256, 3809, 0}, {2304, 3812, 3812}, {256, 3816, 0}, {2304, 3820, 3820}, {256, 3824, 0},
+        {2304, 3828, 3828}, {256, 3832, 0}, {2304, 3836, 3839}, {2304, 3841, 3845}, {2304, 3847, 3851}, {2304, 3853, 3857},
+        {256, 3859, 0}, {256, 3862, 0}, {256, 3865, 0}, {256, 3869, 0}, {256, 3873, 0}, {256, 3877, 0},
+        {256, 3881, 0}, {256, 3885, 0}, {2304, 3889, 3892}, {2304, 3894, 3897}, {2304, 3899, 3903}, {2304, 3905, 3909},
+        {2304, 3911, 3915}, {2304, 3917, 3921}, {2304, 3923, 3927}, {2304, 3929, 3933}, {256, 3935, 0}, {768, 1353, 0},
+        {256, 3938, 0}, {768, 1356, 0}, {256, 3941, 0}, {768, 1359, 0}, {256, 3944, 0}, {768, 1362, 0},
+        {256, 3947, 0}, {768, 1375, 0}, {256, 3950, 0}, {768, 1378, 0}, {256, 3953, 0}, {768, 1381, 0},
+        {2304, 3956, 3960}, {2304, 3963, 3967}, {2304, 3970, 3975}, {2304, 3978, 3983}, {2304, 3986, 3991}, {2304, 3994, 3999},
+        {2304, 4002, 4007}, {2304, 4010, 4015}, {2304, 4018, 3960}, {2304, 4022, 3967}, {2304, 4026, 3975}, {2304, 4031, 3983},
+        {2304, 4036, 3991}, {2304, 4041, 3999}, {2304, 4046, 4007}, {2304, 4051, 4015}, {2304, 4056, 4060}, {2304, 4063, 4067},
+        {2304, 4070, 4075}, {2304, 4078, 4083}, {2304, 4086, 4091}, {2304, 4094, 4099}, {2304, 4102, 4107}, {2304, 4110, 4115},
+        {2304, 4118, 4060}, {2304, 4122, 4067}, {2304, 4126, 4075}, {2304, 4131, 4083}, {2304, 4136, 4091}, {2304, 4141, 4099},
+        {2304, 4146, 4107}, {2304, 4151, 4115}, {2304, 4156, 4160}, {2304, 4163, 4167}, {2304, 4170, 4175}, {2304, 4178, 4183},
+        {2304, 4186, 4191}, {2304, 4194, 4199}, {2304, 4202, 4207}, {2304, 4210, 4215}, {2304, 4218, 4160}, {2304, 4222, 4167},
+        {2304, 4226, 4175}, {2304, 4231, 4183}, {2304, 4236, 4191}, {2304, 4241, 4199}, {2304, 4246, 4207}, {2304, 4251, 4215},
+        {256, 4256, 0}, {256, 4259, 0}, {2304, 4262, 4266}, {2304, 4269, 4272}, {2304, 4275, 4279}, {2304, 4282, 4282},
+        {2304, 4285, 4289}, {2304, 4293, 4296}, {2304, 4298, 4301}, {2304, 4303, 4306}, {2816, 1258, 4308}, {2304, 4310, 4272},
+        {2816, 1241, 1241}, {256, 4313, 0}, {2304, 4316, 4320}, {2304, 4323, 4326}, {2304, 4329, 4333}, {2304, 4336, 4336},
+        {2304, 4339, 4343}, {2304, 4347, 4350}, {2816, 1265, 4352}, {2304, 4354, 4357}, {2816, 1270, 4359}, {2304, 4361, 4326},
+        {256, 4364, 0}, {256, 4367, 0}, {256, 4370, 0}, {256, 4373, 0}, {256, 4376, 0}, {2304, 4379, 4379},
+        {2816, 1295, 1295}, {2304, 4383, 4383}, {2304, 4386, 4386}, {2304, 4390, 4393}, {2304, 4395, 4398}, {2304, 4400, 4403},
+        {2816, 1275, 4405}, {256, 4407, 0}, {256, 4410, 0}, {256, 4413, 0}, {256, 4416, 0}, {256, 4419, 0},
+        {2304, 4422, 4422}, {2816, 1365, 1365}, {2304, 4426, 4426}, {256, 4429, 0}, {2304, 4432, 4432}, {2304, 4435, 4435},
+        {2304, 4439, 4442}, {2304, 4444, 4447}, {2304, 4449, 4452}, {2816, 1285, 4454}, {2304, 4456, 4459}, {256, 4461, 0},
+        {768, 1255, 0}, {768, 4464, 0}, {2304, 4466, 4470}, {2304, 4473, 4476}, {2304, 4479, 4483}, {2304, 4486, 4486},
+        {2304, 4489, 4493}, {2304, 4497, 4500}, {2816, 1280, 4502}, {2304, 4504, 4507}, {2816, 1290, 4509}, {2304, 4511, 4476},
+        {768, 4514, 0}, {768, 4516, 0}, {768, 4518, 0}, {2816, 4520, 1341}, {2816, 4522, 21}, {2816, 80, 83},
+        {2048, 0, 4524}, {2048, 0, 4526}, {2048, 0, 4528}, {2048, 0, 4530}, {2048, 0, 4532}, {2048, 0, 4534},
+        {2048, 0, 4536}, {2048, 0, 4538}, {2048, 0, 4540}, {2048, 0, 4542}, {2048, 0, 4544}, {2048, 0, 4546},
+        {2048, 0, 4548}, {2048, 0, 4550}, {2048, 0, 4552}, {2048, 0, 4554}, {2048, 0, 4556}, {2048, 0, 4558},
+        {256, 4560, 0}, {256, 4563, 0}, {256, 4566, 0}, {256, 4569, 0}, {256, 4572, 0}, {256, 4575, 0},
+        {256, 4578, 0}, {256, 4581, 0}, {256, 4584, 0}, {256, 4587, 0}, {256, 4590, 0}, {256, 4593, 0},
+        {256, 4596, 0}, {256, 4599, 0}, {256, 4602, 0}, {256, 4605, 0}, {256, 4608, 0}, {256, 4611, 0},
+        {256, 4614, 0}, {256, 4617, 0}, {256, 4620, 0}, {256, 4623, 0}, {256, 4626, 0}, {256, 4629, 0},
+        {256, 4632, 0}, {256, 4635, 0}, {256, 4638, 0}, {256, 4641, 0}, {256, 4644, 0}, {256, 4647, 0},
+        {256, 4650, 0}, {256, 4653, 0}, {256, 4656, 0}, {256, 4659, 0}, {256, 4662, 0}, {256, 4665, 0},
+        {256, 4668, 0}, {256, 4671, 0}, {256, 4674, 0}, {256, 4677, 0}, {256, 4680, 0}, {256, 4683, 0},
+        {256, 4686, 0}, {256, 4689, 0}, {768, 4692, 0}, {768, 4694, 0}, {2048, 0, 4696}, {2048, 0, 4698},
+        {2048, 0, 4700}, {2048, 0, 4702}, {2048, 0, 4704}, {2048, 0, 4706}, {2048, 0, 4708}, {2048, 0, 4710},
+        {2048, 0, 4712}, {2048, 0, 4714}, {2048, 0, 4716}, {2048, 0, 4718}, {2048, 0, 4720}, {2048, 0, 4722},
+        {2048, 0, 4724}, {2048, 0, 4726}, {2048, 0, 4728}, {2048, 0, 4730}, {2048, 0, 4732}, {2048, 0, 4734},
+        {2048, 0, 4736}, {2048, 0, 4738}, {2048, 0, 4740}, {2048, 0, 4742}, {2048, 0, 4744}, {2048, 0, 4746},
+        {768, 4748, 0}, {2048, 0, 4751}, {2048, 0, 4753}, {2048, 0, 4755}, {2048, 0, 4757}, {2048, 0, 4759},
+        {2048, 0, 4761}, {2048, 0, 4763}, {2048, 0, 4765}, {2048, 0, 4767}, {2048, 0, 4769}, {2048, 0, 4771},
+        {2048, 0, 4773}, {2048, 0, 4775}, {2048, 0, 4777}, {2048, 0, 4779}, {2048, 0, 4781}, {2048, 0, 4783},
+        {2048, 0, 4785}, {2048, 0, 4787}, {2048, 0, 4789}, {2048, 0, 4791}, {2048, 0, 4793}, {2048, 0, 4795},
+        {2048, 0, 4797}, {2048, 0, 4799}, {2048, 0, 4801}, {2048, 0, 4803}, {2048, 0, 4805}, {2048, 0, 4807},
+        {2048, 0, 4809}, {2048, 0, 4811}, {2048, 0, 4813}, {2048, 0, 4815}, {2048, 0, 4817}, {2048, 0, 4819},
+        {2048, 0, 4821}, {2048, 0, 4823}, {2048, 0, 4825}, {2048, 0, 4827}, {2048, 0, 4829}, {2048, 0, 4831},
+        {2048, 0, 4833}, {2048, 0, 4835}, {2048, 0, 4837}, {2048, 0, 4839}, {2048, 0, 4841}, {2048, 0, 4843},
+        {2048, 0, 4845}, {2048, 0, 4847}, {2048, 0, 4849}, {2048, 0, 4851}, {2048, 0, 4853}, {2048, 0, 4855},
+        {2048, 0, 4857}, {2048, 0, 4859}, {2048, 0, 4861}, {2048, 0, 4863}, {2048, 0, 4865}, {2048, 0, 4867},
+        {2048, 0, 4869}, {2048, 0, 4871}, {2048, 0, 4873}, {2048, 0, 4875}, {2048, 0, 4877}, {2048, 0, 4879},
+        {2048, 0, 4881}, {2048, 0, 4883}, {2048, 0, 4885}, {2048, 0, 4887}, {2048, 0, 4889}, {2048, 0, 4891},
+        {2048, 0, 4893}, {2048, 0, 4895}, {2048, 0, 4897}, {2048, 0, 4899}, {2048, 0, 4901}, {2048, 0, 4903},
+        {2048, 0, 4905}, {2048, 0, 4907}, {2048, 0, 4909}, {2048, 0, 4911}, {2048, 0, 4913}, {2048, 0, 4915},
+        {2048, 0, 4917}, {2048, 0, 4919}, {2048, 0, 4921}, {2048, 0, 4923}, {2048, 0, 4925}, {2048, 0, 4927},
+        {2048, 0, 4929}, {2048, 0, 4931}, {2048, 0, 4933}, {2048, 0, 4935}, {2048, 0, 4937}, {2048, 0, 4939},
+        {2048, 0, 4941}, {2048, 0, 4943}, {2048, 0, 4945}, {2048, 0, 4947}, {2048, 0, 4949}, {2048, 0, 4951},
+        {2048, 0, 4953}, {2048, 0, 4955}, {2048, 0, 4957}, {2048, 0, 4959}, {2048, 0, 4961}, {2048, 0, 4963},
+        {2048, 0, 4965}, {2048, 0, 4967}, {2048, 0, 4969}, {2048, 0, 4971}, {2048, 0, 4973}, {2048, 0, 4975},
+        {2048, 0, 4977}, {2048, 0, 4979}, {2048, 0, 4981}, {224, 0, 0}, {256, 4983, 0}, {256, 4986, 0},
+        {256, 4989, 0}, {256, 4992, 0}, {256, 4995, 0}, {256, 4998, 0}, {256, 5001, 0}, {256, 5004, 0},
+        {256, 5007, 0}, {256, 5010, 0}, {256, 5013, 0}, {256, 5016, 0}, {256, 5019, 0}, {256, 5022, 0},
+        {256, 5025, 0}, {256, 5028, 0}, {256, 5031, 0}, {256, 5034, 0}, {256, 5037, 0}, {256, 5040, 0},
+        {256, 5043, 0}, {256, 5046, 0}, {256, 5049, 0}, {256, 5052, 0}, {256, 5055, 0}, {256, 5058, 0},
+        {1032, 0, 0}, {256, 5061, 0}, {256, 5064, 0}, {256, 5067, 0}, {256, 5070, 0}, {256, 5073, 0},
+        {256, 5076, 0}, {256, 5079, 0}, {256, 5082, 0}, {256, 5085, 0}, {256, 5088, 0}, {256, 5091, 0},
+        {256, 5094, 0}, {256, 5097, 0}, {256, 5100, 0}, {256, 5103, 0}, {256, 5106, 0}, {256, 5109, 0},
+        {256, 5112, 0}, {256, 5115, 0}, {256, 5118, 0}, {256, 5121, 0}, {256, 5124, 0}, {256, 5127, 0},
+        {256, 5130, 0}, {256, 5133, 0}, {256, 5136, 0}, {256, 5139, 0}, {256, 5142, 0}, {256, 5145, 0},
+        {256, 5148, 0}, {256, 5151, 0}, {256, 5154, 0}, {2048, 0, 5157}, {2048, 0, 5159}, {2048, 0, 5161},
+        {2048, 0, 5163}, {2048, 0, 5165}, {2048, 0, 5167}, {2048, 0, 5169}, {2048, 0, 5171}, {2048, 0, 5173},
+        {2048, 0, 5175}, {2048, 0, 5177}, {2048, 0, 5179}, {2048, 0, 5181}, {2048, 0, 5183}, {2048, 0, 5185},
+        {2048, 0, 5187}, {2048, 0, 5189}, {2048, 0, 5191}, {2048, 0, 5193}, {2048, 0, 5195}, {2048, 0, 5197},
+        {2048, 0, 5199}, {2048, 0, 5201}, {2048, 0, 5203}, {2048, 0, 5205}, {2048, 0, 5207}, {2048, 0, 5209},
+        {2048, 0, 5211}, {2048, 0, 5213}, {2048, 0, 5215}, {2048, 0, 5217}, {2048, 0, 5219}, {2048, 0, 5221},
+        {2048, 0, 5223}, {2048, 0, 5225}, {2048, 0, 5227}, {2048, 0, 5229}, {2048, 0, 5231}, {2048, 0, 5233},
+        {2048, 0, 5235}, {2048, 0, 5237}, {2048, 0, 5239}, {2048, 0, 5241}, {2048, 0, 5243}, {2048, 0, 5245},
+        {2048, 0, 5247}, {2048, 0, 5249}, {2048, 0, 5251}, {2048, 0, 5253}, {2048, 0, 5255}, {2048, 0, 5257},
+        {2048, 0, 5259}, {2048, 0, 5261}, {2048, 0, 5263}, {2048, 0, 5265}, {2048, 0, 5267}, {2048, 0, 5269},
+        {2048, 0, 5271}, {2048, 0, 5273}, {2048, 0, 5275}, {2048, 0, 5277}, {2048, 0, 5279}, {2048, 0, 5281},
+        {2048, 0, 5283}, {2048, 0, 5285}, {2048, 0, 5287}, {2048, 0, 5289}, {2048, 0, 5291}, {2048, 0, 5293},
+        {2048, 0, 5295}, {2048, 0, 5297}, {2048, 0, 5299}, {2048, 0, 5301}, {2048, 0, 5303}, {2048, 0, 5305},
+        {2048, 0, 5307}, {2048, 0, 5309}, {2048, 0, 5311}, {2048, 0, 5313}, {2048, 0, 5315}, {2048, 0, 5317},
+        {2048, 0, 5319}, {2048, 0, 5321}, {2048, 0, 5323}, {2048, 0, 5325}, {2048, 0, 5327}, {2048, 0, 5329},
+        {2048, 0, 5331}, {2048, 0, 5333}, {2048, 0, 5335}, {2048, 0, 5337}, {2048, 0, 5339}, {2048, 0, 5341},
+        {2048, 0, 5343}, {2048, 0, 5345}, {2048, 0, 5347}, {2048, 0, 5349}, {2048, 0, 5351}, {2048, 0, 5353},
+        {2048, 0, 5355}, {2048, 0, 5357}, {2048, 0, 5359}, {2048, 0, 5361}, {2048, 0, 5363}, {2048, 0, 5365},
+        {2048, 0, 5367}, {2048, 0, 5369}, {2048, 0, 5371}, {2048, 0, 5373}, {2048, 0, 5375}, {2048, 0, 5377},
+        {2048, 0, 5379}, {2048, 0, 5381}, {2048, 0, 5383}, {2048, 0, 5385}, {2048, 0, 5387}, {2048, 0, 5389},
+        {2048, 0, 5391}, {2048, 0, 5393}, {2048, 0, 5395}, {2048, 0, 5397}, {2048, 0, 5399}, {2048, 0, 5401},
+        {2048, 0, 5403}, {2048, 0, 5405}, {2048, 0, 5407}, {2048, 0, 5409}, {2048, 0, 5411}, {2048, 0, 5413},
+        {2048, 0, 5415}, {2048, 0, 5417}, {2048, 0, 5419}, {2048, 0, 5421}, {2048, 0, 5423}, {2048, 0, 5425},
+        {2048, 0, 5427}, {2048, 0, 5429}, {2048, 0, 5431}, {2048, 0, 5433}, {2048, 0, 5435}, {2048, 0, 5437},
+        {2048, 0, 5439}, {2048, 0, 5441}, {2048, 0, 5443}, {2048, 0, 5445}, {2048, 0, 5447}, {2048, 0, 5449},
+        {2048, 0, 5451}, {2048, 0, 5453}, {2048, 0, 5455}, {2048, 0, 5457}, {2048, 0, 5459}, {2048, 0, 5461},
+        {2048, 0, 5463}, {2048, 0, 5465}, {2048, 0, 5467}, {2048, 0, 5469}, {2048, 0, 5471}, {2048, 0, 5473},
+        {2048, 0, 5475}, {2048, 0, 5477}, {2048, 0, 5479}, {2048, 0, 5481}, {2048, 0, 5483}, {2048, 0, 5485},
+        {2048, 0, 5487}, {2048, 0, 5489}, {2048, 0, 5491}, {2048, 0, 5493}, {2048, 0, 5495}, {2048, 0, 5497},
+        {2048, 0, 5499}, {2048, 0, 5501}, {2048, 0, 5503}, {2048, 0, 5505}, {2048, 0, 5507}, {2048, 0, 5509},
+        {2048, 0, 5511}, {2048, 0, 5513}, {2048, 0, 5515}, {2048, 0, 5517}, {2048, 0, 5519}, {2048, 0, 5521},
+        {2048, 0, 5523}, {2048, 0, 5525}, {2048, 0, 5527}, {2048, 0, 5529}, {2048, 0, 5531}, {2048, 0, 5533},
+        {2048, 0, 5535}, {2048, 0, 5537}, {2048, 0, 5539}, {2048, 0, 5541}, {2048, 0, 5543}, {2048, 0, 5545},
+        {2048, 0, 5547}, {2048, 0, 5549}, {2048, 0, 5551}, {2048, 0, 5553}, {2048, 0, 5555}, {2048, 0, 5557},
+        {2048, 0, 5559}, {256, 0, 0}, {768, 5561, 0}, {768, 5563, 0}, {768, 5565, 0}, {768, 5567, 0},
+        {768, 5569, 0}, {768, 5571, 0}, {768, 5573, 0}, {768, 5575, 0}, {768, 5577, 0}, {768, 5579, 0},
+        {768, 5581, 0}, {768, 5583, 0}, {768, 5585, 0}, {768, 5587, 0}, {768, 5589, 0}, {768, 5591, 0},
+        {768, 5593, 0}, {768, 5595, 0}, {768, 5597, 0}, {768, 5599, 0}, {768, 5601, 0}, {768, 5603, 0},
+        {768, 5605, 0}, {768, 5607, 0}, {768, 5609, 0}, {768, 5611, 0}, {768, 5613, 0}, {768, 5615, 0},
+        {768, 5617, 0}, {768, 5619, 0}, {768, 5621, 0}, {768, 5623, 0}, {768, 5625, 0}, {768, 5627, 0},
+        {768, 5629, 0}, {768, 5631, 0}, {768, 5633, 0}, {768, 5635, 0}, {768, 5637, 0}, {768, 5639, 0},
+        {768, 5641, 0}, {768, 5643, 0}, {768, 5645, 0}, {768, 5647, 0}, {768, 5649, 0}, {768, 5651, 0},
+        {768, 5653, 0}, {768, 5655, 0}, {768, 5657, 0}, {768, 5659, 0}, {768, 5661, 0}, {768, 5663, 0},
+        {768, 5665, 0}, {768, 5667, 0}, {768, 5669, 0}, {768, 5671, 0}, {768, 5673, 0}, {768, 5675, 0},
+        {768, 5677, 0}, {768, 5679, 0}, {768, 5681, 0}, {768, 5683, 0}, {768, 5685, 0}, {768, 5687, 0},
+        {768, 5689, 0}, {768, 5691, 0}, {768, 5693, 0}, {768, 5695, 0}, {768, 5697, 0}, {768, 5699, 0},
+        {768, 5701, 0}, {768, 5703, 0}, {768, 5705, 0}, {768, 5707, 0}, {768, 5709, 0}, {768, 5711, 0},
+        {768, 5713, 0}, {768, 5715, 0}, {768, 5717, 0}, {768, 5719, 0}, {768, 5721, 0}, {768, 5723, 0},
+        {768, 5725, 0}, {768, 5727, 0}, {768, 5729, 0}, {768, 5731, 0}, {768, 5733, 0}, {768, 5735, 0},
+        {768, 5737, 0}, {768, 5739, 0}, {768, 5741, 0}, {768, 5743, 0}, {768, 5745, 0}, {768, 5747, 0},
+        {768, 5749, 0}, {768, 5751, 0}, {768, 5753, 0}, {768, 5755, 0}, {768, 5757, 0}, {768, 5759, 0},
+        {768, 5761, 0}, {768, 5763, 0}, {768, 5765, 0}, {768, 5767, 0}, {768, 5769, 0}, {768, 5771, 0},
+        {768, 5773, 0}, {768, 5775, 0}, {768, 5777, 0}, {768, 5779, 0}, {768, 5781, 0}, {768, 5783, 0},
+        {768, 5785, 0}, {768, 5787, 0}, {768, 5789, 0}, {768, 5791, 0}, {768, 5793, 0}, {768, 5795, 0},
+        {768, 5797, 0}, {768, 5799, 0}, {768, 5801, 0}, {768, 5803, 0}, {768, 5805, 0}, {768, 5807, 0},
+        {768, 5809, 0}, {768, 5811, 0}, {768, 5813, 0}, {768, 5815, 0}, {768, 5817, 0}, {768, 5819, 0},
+        {768, 5821, 0}, {768, 5823, 0}, {768, 5825, 0}, {768, 5827, 0}, {768, 5829, 0}, {768, 5831, 0},
+        {768, 5833, 0}, {768, 5835, 0}, {768, 5837, 0}, {768, 5839, 0}, {768, 5841, 0}, {768, 5843, 0},
+        {768, 5845, 0}, {768, 5847, 0}, {768, 5849, 0}, {768, 5851, 0}, {768, 5853, 0}, {768, 5855, 0},
+        {768, 5857, 0}, {768, 5859, 0}, {768, 5861, 0}, {768, 5863, 0}, {768, 5865, 0}, {768, 5867, 0},
+        {768, 5869, 0}, {768, 5871, 0}, {768, 5873, 0}, {768, 5875, 0}, {768, 5877, 0}, {768, 5879, 0},
+        {768, 5881, 0}, {768, 5883, 0}, {768, 5885, 0}, {768, 5887, 0}, {768, 5889, 0}, {768, 5891, 0},
+        {768, 5893, 0}, {768, 5895, 0}, {768, 5897, 0}, {768, 5899, 0}, {768, 5901, 0}, {768, 5903, 0},
+        {768, 5905, 0}, {768, 5907, 0}, {768, 5909, 0}, {768, 5911, 0}, {768, 5913, 0}, {768, 5915, 0},
+        {768, 5917, 0}, {768, 5919, 0}, {768, 5921, 0}, {768, 5923, 0}, {768, 5925, 0}, {768, 5927, 0},
+        {768, 5929, 0}, {768, 5931, 0}, {768, 5933, 0}, {768, 5935, 0}, {768, 5937, 0}, {768, 5939, 0},
+        {768, 5941, 0}, {768, 5943, 0}, {768, 5945, 0}, {768, 5947, 0}, {768, 5949, 0}, {768, 5951, 0},
+        {768, 5953, 0}, {768, 5955, 0}, {768, 5957, 0}, {768, 5959, 0}, {768, 5961, 0}, {768, 5963, 0},
+        {768, 5965, 0}, {768, 5967, 0}, {768, 5969, 0}, {768, 5971, 0}, {768, 5973, 0}, {768, 5975, 0},
+        {768, 5977, 0}, {768, 5979, 0}, {768, 5981, 0}, {768, 5983, 0}, {768, 5985, 0}, {768, 5987, 0},
+        {768, 5989, 0}, {768, 5991, 0}, {768, 5993, 0}, {768, 5995, 0}, {768, 5997, 0}, {768, 5999, 0},
+        {768, 6001, 0}, {768, 6003, 0}, {768, 6005, 0}, {768, 6007, 0}, {768, 6009, 0}, {768, 6011, 0},
+        {768, 6013, 0}, {768, 6015, 0}, {768, 6017, 0}, {768, 6019, 0}, {768, 6021, 0}, {768, 6023, 0},
+        {768, 6025, 0}, {768, 6027, 0}, {768, 6029, 0}, {768, 6031, 0}, {768, 6033, 0}, {768, 6035, 0},
+        {768, 6037, 0}, {768, 6039, 0}, {768, 6041, 0}, {768, 6043, 0}, {768, 6045, 0}, {768, 6047, 0},
+        {768, 6049, 0}, {768, 6051, 0}, {768, 6053, 0}, {768, 6055, 0}, {768, 6057, 0}, {768, 6059, 0},
+        {768, 6061, 0}, {768, 6063, 0}, {768, 6065, 0}, {768, 6067, 0}, {768, 6069, 0}, {768, 6071, 0},
+        {768, 6073, 0}, {768, 6075, 0}, {768, 6077, 0}, {768, 6079, 0}, {768, 6081, 0}, {768, 6083, 0},
+        {768, 6085, 0}, {768, 6087, 0}, {768, 6089, 0}, {768, 6091, 0}, {768, 6093, 0}, {768, 6095, 0},
+        {768, 6097, 0}, {768, 6099, 0}, {768, 6101, 0}, {768, 6103, 0}, {768, 6105, 0}, {768, 6107, 0},
+        {768, 6109, 0}, {768, 6111, 0}, {768, 6113, 0}, {768, 6115, 0}, {768, 6117, 0}, {768, 6119, 0},
+        {768, 6121, 0}, {768, 6123, 0}, {768, 6125, 0}, {768, 6127, 0}, {768, 6129, 0}, {768, 6131, 0},
+        {768, 6133, 0}, {768, 6135, 0}, {768, 6137, 0}, {768, 6139, 0}, {768, 6141, 0}, {768, 6143, 0},
+        {768, 6145, 0}, {768, 6147, 0}, {768, 6149, 0}, {768, 6151, 0}, {768, 6153, 0}, {768, 6155, 0},
+        {768, 6157, 0}, {768, 6159, 0}, {768, 6161, 0}, {768, 6163, 0}, {768, 6165, 0}, {768, 6167, 0},
+        {768, 6169, 0}, {768, 6171, 0}, {768, 6173, 0}, {768, 6175, 0}, {768, 6177, 0}, {768, 6179, 0},
+        {768, 6181, 0}, {768, 6183, 0}, {768, 6185, 0}, {768, 6187, 0}, {768, 6189, 0}, {768, 6191, 0},
+        {768, 6193, 0}, {768, 6195, 0}, {768, 6197, 0}, {768, 6199, 0}, {768, 6201, 0}, {768, 6203, 0},
+        {768, 6205, 0}, {768, 6207, 0}, {768, 6209, 0}, {768, 6211, 0}, {768, 6213, 0}, {768, 6215, 0},
+        {768, 6217, 0}, {768, 6219, 0}, {768, 6221, 0}, {768, 6223, 0}, {768, 6225, 0}, {768, 6227, 0},
+        {768, 6229, 0}, {768, 6231, 0}, {768, 6233, 0}, {768, 6235, 0}, {768, 6237, 0}, {768, 6239, 0},
+        {768, 6241, 0}, {768, 6243, 0}, {768, 6245, 0}, {768, 6247, 0}, {768, 6249, 0}, {768, 6251, 0},
+        {768, 6253, 0}, {768, 6255, 0}, {768, 6257, 0}, {768, 6259, 0}, {768, 6261, 0}, {768, 6263, 0},
+        {768, 6265, 0}, {768, 6267, 0}, {768, 6269, 0}, {768, 6271, 0}, {768, 6273, 0}, {768, 6275, 0},
+        {768, 6277, 0}, {768, 6279, 0}, {768, 6281, 0}, {768, 6283, 0}, {768, 6285, 0}, {768, 6287, 0},
+        {768, 6289, 0}, {768, 6291, 0}, {768, 6293, 0}, {768, 6295, 0}, {768, 6297, 0}, {768, 6299, 0},
+        {768, 6301, 0}, {768, 6303, 0}, {768, 6305, 0}, {768, 6307, 0}, {768, 6309, 0}, {768, 6311, 0},
+        {768, 6313, 0}, {768, 6315, 0}, {768, 6317, 0}, {768, 6319, 0}, {768, 6321, 0}, {768, 6323, 0},
+        {768, 6325, 0}, {768, 6327, 0}, {768, 6329, 0}, {768, 6331, 0}, {768, 6333, 0}, {768, 6335, 0},
+        {768, 6337, 0}, {768, 6339, 0}, {768, 6341, 0}, {768, 6343, 0}, {768, 6345, 0}, {768, 6347, 0},
+        {768, 6349, 0}, {768, 6351, 0}, {768, 6353, 0}, {768, 6355, 0}, {768, 6357, 0}, {768, 6359, 0},
+        {768, 6361, 0}, {768, 6363, 0}, {768, 6365, 0}, {768, 6367, 0}, {768, 6369, 0}, {768, 6371, 0},
+        {768, 6373, 0}, {768, 6375, 0}, {768, 6377, 0}, {768, 6379, 0}, {768, 6381, 0}, {768, 6383, 0},
+        {768, 6385, 0}, {768, 6387, 0}, {768, 6389, 0}, {768, 6391, 0}, {768, 6393, 0}, {768, 6395, 0},
+        {768, 6397, 0}, {768, 6399, 0}, {768, 6401, 0}, {768, 6403, 0}, {768, 6405, 0}, {768, 6407, 0},
+        {768, 6409, 0}, {2048, 0, 6411}, {2048, 0, 6414}, {2048, 0, 6417}, {2048, 0, 6420}, {2048, 0, 6424},
+        {2048, 0, 6428}, {2048, 0, 6431}, {2048, 0, 6434}, {2048, 0, 6437}, {2048, 0, 6440}, {2048, 0, 6443},
+        {768, 6446, 0}, {26, 0, 0}, {768, 6449, 0}, {768, 6452, 0}, {768, 6455, 0}, {768, 6458, 0},
+        {768, 6462, 0}, {768, 6466, 0}, {768, 6469, 0}, {768, 6472, 0}, {768, 6475, 0}, {768, 6478, 0},
+        {768, 6481, 0}, {768, 6484, 0}, {768, 6487, 0}, {768, 6490, 0}, {768, 6493, 0}, {768, 6496, 0},
+        {768, 6499, 0}, {768, 6502, 0}, {768, 6505, 0}, {768, 6508, 0}, {768, 6511, 0}, {768, 6514, 0},
+        {768, 6517, 0}, {768, 6520, 0}, {768, 6523, 0}, {768, 6526, 0}, {768, 6529, 0}, {768, 6532, 0},
+        {768, 6535, 0}, {768, 6538, 0}, {768, 6541, 0}, {768, 6544, 0}, {768, 6547, 0}, {2048, 0, 6550},
+        {2048, 0, 6552}, {2048, 0, 6554}, {2048, 0, 6556}, {2048, 0, 6558}, {2048, 0, 6560}, {2048, 0, 6562},
+        {2048, 0, 6564}, {2048, 0, 6566}, {2048, 0, 6568}, {2048, 0, 6570}, {2048, 0, 6572}, {2048, 0, 6574},
+        {2048, 0, 6576}, {2048, 0, 6578}, {2048, 0, 6580}, {2048, 0, 6582}, {2048, 0, 6584}, {2048, 0, 6586},
+        {2048, 0, 6588}, {2048, 0, 6590}, {2048, 0, 6592}, {2048, 0, 6594}, {2048, 0, 6596}, {2048, 0, 6598},
+        {2048, 0, 6600}, {2048, 0, 6602}, {2048, 0, 6604}, {2048, 0, 6606}, {2048, 0, 6608}, {2048, 0, 6610},
+        {2048, 0, 6612}, {2048, 0, 6614}, {2048, 0, 6616}, {2048, 0, 6618}, {2048, 0, 6620}, {2048, 0, 6622},
+        {2048, 0, 6624}, {2048, 0, 6626}, {2048, 0, 6628}, {2048, 0, 6630}, {2048, 0, 6632}, {2048, 0, 6634},
+        {2048, 0, 6636}, {2048, 0, 6638}, {2048, 0, 6640}, {2048, 0, 6642}, {2048, 0, 6644}, {2048, 0, 6646},
+        {2048, 0, 6648}, {2048, 0, 6650}, {2048, 0, 6652}, {2048, 0, 6654}, {2048, 0, 6656}, {2048, 0, 6658},
+        {2048, 0, 6660}, {2048, 0, 6662}, {2048, 0, 6664}, {2048, 0, 6666}, {2048, 0, 6668}, {2048, 0, 6670},
+        {2048, 0, 6672}, {2048, 0, 6674}, {2048, 0, 6676}, {2048, 0, 6678}, {2048, 0, 6680}, {2048, 0, 6682},
+        {2048, 0, 6684}, {2048, 0, 6686}, {2048, 0, 6688}, {2048, 0, 6690}, {2048, 0, 6692}, {2048, 0, 6694},
+        {2048, 0, 6696}, {2048, 0, 6698}, {2048, 0, 6700}, {2048, 0, 6702}, {2048, 0, 6704}, {2048, 0, 6706},
+        {2048, 0, 6708}, {2048, 0, 6710}, {2048, 0, 6712}, {2048, 0, 6714}, {2048, 0, 6716}, {2048, 0, 6718},
+        {2048, 0, 6720}, {2048, 0, 6722}, {2048, 0, 6724}, {2048, 0, 6726}, {2048, 0, 6728}, {2048, 0, 6730},
+        {2048, 0, 6732}, {2048, 0, 6734}, {2048, 0, 6736}, {2048, 0, 6738}, {2048, 0, 6740}, {2048, 0, 6742},
+        {2048, 0, 6744}, {2048, 0, 6746}, {2048, 0, 6748}, {2048, 0, 6750}, {2048, 0, 6752}, {2048, 0, 6754},
+        {2048, 0, 6756}, {2048, 0, 6758}, {2048, 0, 6760}, {2048, 0, 6762}, {2048, 0, 6764}, {2048, 0, 6766},
+        {2048, 0, 6768}, {2048, 0, 6770}, {2048, 0, 6772}, {2048, 0, 6774}, {2048, 0, 6776}, {2048, 0, 6778},
+        {2048, 0, 6780}, {2048, 0, 6782}, {2048, 0, 6784}, {2048, 0, 6786}, {2048, 0, 6788}, {2048, 0, 6790},
+        {2048, 0, 6792}, {2048, 0, 6794}, {2048, 0, 6796}, {2048, 0, 6798}, {2048, 0, 6800}, {2048, 0, 6802},
+        {2048, 0, 6804}, {2048, 0, 6806}, {2048, 0, 6808}, {2048, 0, 6810}, {2048, 0, 6812}, {2048, 0, 6814},
+        {2048, 0, 6816}, {2048, 0, 6818}, {2048, 0, 6820}, {2048, 0, 6822}, {2048, 0, 6824}, {2048, 0, 6826},
+        {2048, 0, 6828}, {2048, 0, 6830}, {2048, 0, 6832}, {2048, 0, 6834}, {2048, 0, 6836}, {2048, 0, 6838},
+        {2048, 0, 6840}, {2048, 0, 6842}, {2048, 0, 6844}, {2048, 0, 6846}, {2048, 0, 6848}, {2048, 0, 6850},
+        {2048, 0, 6852}, {2048, 0, 6854}, {2048, 0, 6856}, {2048, 0, 6858}, {2048, 0, 6860}, {2048, 0, 6862},
+        {2048, 0, 6864}, {2048, 0, 6866}, {2048, 0, 6868}, {2048, 0, 6870}, {2048, 0, 6872}, {2048, 0, 6874},
+        {2048, 0, 6876}, {2048, 0, 6878}, {2048, 0, 6880}, {2048, 0, 6882}, {2048, 0, 6884}, {2048, 0, 6886},
+        {2048, 0, 6888}, {2048, 0, 6890}, {2048, 0, 6892}, {2048, 0, 6894}, {2048, 0, 6896}, {2048, 0, 6898},
+        {2048, 0, 6900}, {2048, 0, 6902}, {2048, 0, 6904}, {2048, 0, 6906}, {2048, 0, 6908}, {2048, 0, 6910},
+        {2048, 0, 6912}, {2048, 0, 6914}, {2048, 0, 6916}, {2048, 0, 6918}, {2048, 0, 6920}, {2048, 0, 6922},
+        {2048, 0, 6924}, {256, 6926, 0}, {256, 6929, 0}, {256, 6932, 0}, {256, 6935, 0}, {256, 6938, 0},
+        {256, 6941, 0}, {256, 6944, 0}, {256, 6947, 0}, {256, 6950, 0}, {256, 6953, 0}, {256, 6956, 0},
+        {256, 6959, 0}, {2048, 0, 6962}, {2048, 0, 6964}, {2048, 0, 6966}, {2048, 0, 6968}, {2048, 0, 6970},
+        {2048, 0, 6972}, {2048, 0, 6974}, {2048, 0, 6976}, {2048, 0, 6978}, {2048, 0, 6980}, {2048, 0, 6982},
+        {2048, 0, 6984}, {2048, 0, 6986}, {2048, 0, 6988}, {2048, 0, 6990}, {2048, 0, 6992}, {2048, 0, 6994},
+        {2048, 0, 6996}, {2048, 0, 6998}, {2048, 0, 7000}, {2048, 0, 7002}, {2048, 0, 7004}, {2048, 0, 7006},
+        {2048, 0, 7008}, {2048, 0, 7010}, {2048, 0, 7012}, {2048, 0, 7014}, {2048, 0, 7016}, {2048, 0, 7018},
+        {2048, 0, 7020}, {2048, 0, 7022}, {2048, 0, 7024}, {256, 7026, 0}, {2048, 0, 7029}, {2048, 0, 7031},
+        {2048, 0, 7033}, {2048, 0, 7035}, {2048, 0, 7037}, {2048, 0, 7039}, {2048, 0, 7041}, {2048, 0, 7043},
+        {2048, 0, 7045}, {2048, 0, 7047}, {2048, 0, 7049}, {2048, 0, 7051}, {2048, 0, 7053}, {2048, 0, 7055},
+        {2048, 0, 7057}, {2048, 0, 7059}, {2048, 0, 7061}, {2048, 0, 7063}, {2048, 0, 7065}, {2048, 0, 7067},
+        {2048, 0, 7069}, {2048, 0, 7071}, {2048, 0, 7073}, {2048, 0, 7075}, {2048, 0, 7077}, {2048, 0, 7079},
+        {2048, 0, 7081}, {2048, 0, 7083}, {2048, 0, 7085}, {2048, 0, 7087}, {2048, 0, 7089}, {2048, 0, 7091},
+        {6, 0, 0}, {768, 7093, 0}, {768, 7096, 0}, {768, 7099, 0}, {768, 7103, 0}, {768, 7107, 0},
+        {768, 7111, 0}, {768, 7115, 0}, {226, 0, 0}, {768, 7119, 0}, {768, 7122, 0}, {768, 7125, 0},
+        {768, 7129, 0}, {768, 7133, 0}, {768, 7137, 0}, {2048, 0, 7141}, {2048, 0, 7143}, {2048, 0, 7145},
+        {2048, 0, 7147}, {2048, 0, 7149}, {2048, 0, 7151}, {2048, 0, 7153}, {2048, 0, 7155}, {2048, 0, 7157},
+        {2048, 0, 7159}, {2048, 0, 7161}, {2048, 0, 7163}, {2048, 0, 7165}, {2048, 0, 7167}, {2048, 0, 7169},
+        {2048, 0, 7171}, {2048, 0, 7173}, {2048, 0, 7175}, {2048, 0, 7177}, {2048, 0, 7179}, {2048, 0, 7181},
+        {2048, 0, 7183}, {2048, 0, 7185}, {2048, 0, 7187}, {2048, 0, 7189}, {2048, 0, 7191}, {2048, 0, 7193},
+        {2048, 0, 7195}, {2048, 0, 7197}, {2048, 0, 7199}, {2048, 0, 7201}, {2048, 0, 7203}, {2048, 0, 7205},
+        {2048, 0, 7207}, {768, 7209, 0}, {768, 7211, 0}, {768, 7213, 0}, {768, 7215, 0}, {768, 7217, 0},
+        {768, 7219, 0}, {768, 7221, 0}, {768, 7223, 0}, {768, 7225, 0}, {768, 7227, 0}, {768, 7229, 0},
+        {768, 7231, 0}, {768, 7233, 0}, {768, 7235, 0}, {768, 7237, 0}, {768, 7239, 0}, {768, 7241, 0},
+        {768, 7243, 0}, {768, 7245, 0}, {768, 7247, 0}, {768, 7249, 0}, {768, 7251, 0}, {768, 7253, 0},
+        {768, 7255, 0}, {768, 7257, 0}, {768, 7259, 0}, {768, 7261, 0}, {768, 7263, 0}, {768, 7265, 0},
+        {768, 7267, 0}, {768, 7269, 0}, {768, 7271, 0}, {768, 7273, 0}, {768, 7275, 0}, {768, 7277, 0},
+        {768, 7279, 0}, {768, 7281, 0}, {768, 7283, 0}, {768, 7285, 0}, {768, 7287, 0}, {768, 7289, 0},
+        {768, 7291, 0}, {768, 7293, 0}, {768, 7295, 0}, {768, 7297, 0}, {768, 7299, 0}, {768, 7301, 0},
+        {768, 7303, 0}, {768, 7305, 0}, {768, 7307, 0}, {768, 7309, 0}, {768, 7311, 0}, {768, 7313, 0},
+        {768, 7315, 0}, {768, 7317, 0}, {768, 7319, 0}, {768, 7321, 0}, {768, 7323, 0}, {768, 7325, 0},
+        {768, 7327, 0}, {768, 7329, 0}, {768, 7331, 0}, {768, 7333, 0}, {768, 7335, 0}, {768, 7337, 0},
+        {768, 7339, 0}, {768, 7341, 0}, {768, 7343, 0}, {768, 7345, 0}, {768, 7347, 0}, {768, 7349, 0},
+        {768, 7351, 0}, {768, 7353, 0}, {768, 7355, 0}, {768, 7357, 0}, {768, 7359, 0}, {768, 7361, 0},
+        {768, 7363, 0}, {768, 7365, 0}, {768, 7367, 0}, {768, 7369, 0}, {768, 7371, 0}, {768, 7373, 0},
+        {768, 7375, 0}, {768, 7377, 0}, {768, 7379, 0}, {768, 7381, 0}, {768, 7383, 0}, {768, 7385, 0},
+        {768, 7387, 0}, {768, 7389, 0}, {768, 7391, 0}, {768, 7393, 0}, {768, 7395, 0}, {768, 7397, 0},
+        {768, 7399, 0}, {768, 7401, 0}, {768, 7403, 0}, {768, 7405, 0}, {768, 7407, 0}, {768, 7409, 0},
+        {768, 7411, 0}, {768, 7413, 0}, {768, 7415, 0}, {768, 7417, 0}, {768, 7419, 0}, {768, 7421, 0},
+        {768, 7423, 0}, {768, 7425, 0}, {768, 7427, 0}, {768, 7429, 0}, {768, 7431, 0}, {768, 7433, 0},
+        {768, 7435, 0}, {768, 7437, 0}, {768, 7439, 0}, {768, 7441, 0}, {768, 7443, 0}, {768, 7445, 0},
+        {768, 7447, 0}, {768, 7449, 0}, {768, 7451, 0}, {768, 7453, 0}, {768, 7455, 0}, {768, 7457, 0},
+        {768, 7459, 0}, {768, 7461, 0}, {768, 7463, 0}, {768, 7465, 0}, {768, 7467, 0}, {768, 7469, 0},
+        {768, 7471, 0}, {768, 7473, 0}, {768, 7475, 0}, {768, 7477, 0}, {768, 7479, 0}, {768, 7481, 0},
+        {768, 7483, 0}, {768, 7485, 0}, {768, 7487, 0}, {768, 7489, 0}, {768, 7491, 0}, {768, 7493, 0},
+        {768, 7495, 0}, {768, 7497, 0}, {768, 7499, 0}, {768, 7501, 0}, {768, 7503, 0}, {768, 7505, 0},
+        {768, 7507, 0}, {768, 7509, 0}, {768, 7511, 0}, {768, 7513, 0}, {768, 7515, 0}, {768, 7517, 0},
+        {768, 7519, 0}, {768, 7521, 0}, {768, 7523, 0}, {768, 7525, 0}, {768, 7527, 0}, {768, 7529, 0},
+        {768, 7531, 0}, {768, 7533, 0}, {768, 7535, 0}, {768, 7537, 0}, {768, 7539, 0}, {768, 7541, 0},
+        {768, 7543, 0}, {768, 7545, 0}, {768, 7547, 0}, {768, 7549, 0}, {768, 7551, 0}, {768, 7553, 0},
+        {768, 7555, 0}, {768, 7557, 0}, {768, 7559, 0}, {768, 7561, 0}, {768, 7563, 0}, {768, 7565, 0},
+        {768, 7567, 0}, {768, 7569, 0}, {768, 7571, 0}, {768, 7573, 0}, {768, 7575, 0}, {768, 7577, 0},
+        {768, 7579, 0}, {768, 7581, 0}, {768, 7583, 0}, {768, 7585, 0}, {768, 7587, 0}, {768, 7589, 0},
+        {768, 7591, 0}, {768, 7593, 0}, {768, 7595, 0}, {768, 7597, 0}, {768, 7599, 0}, {768, 7601, 0},
+        {768, 7603, 0}, {768, 7605, 0}, {768, 7607, 0}, {768, 7609, 0}, {768, 7611, 0}, {768, 7613, 0},
+        {768, 7615, 0}, {768, 7617, 0}, {768, 7619, 0}, {768, 7621, 0}, {768, 7623, 0}, {768, 7625, 0},
+        {768, 7627, 0}, {768, 7629, 0}, {768, 7631, 0}, {768, 7633, 0}, {768, 7635, 0}, {768, 7637, 0},
+        {768, 7639, 0}, {768, 7641, 0}, {768, 7643, 0}, {768, 7645, 0}, {768, 7647, 0}, {768, 7649, 0},
+        {768, 7651, 0}, {768, 7653, 0}, {768, 7655, 0}, {768, 7657, 0}, {768, 7659, 0}, {768, 7661, 0},
+        {768, 7663, 0}, {768, 7665, 0}, {768, 7667, 0}, {768, 7669, 0}, {768, 7671, 0}, {768, 7673, 0},
+        {768, 7675, 0}, {768, 7677, 0}, {768, 7679, 0}, {768, 7681, 0}, {768, 7683, 0}, {768, 7685, 0},
+        {768, 7687, 0}, {768, 7689, 0}, {768, 7691, 0}, {768, 7693, 0}, {768, 7695, 0}, {768, 7697, 0},
+        {768, 7699, 0}, {768, 7701, 0}, {768, 7703, 0}, {768, 7705, 0}, {768, 7707, 0}, {768, 7709, 0},
+        {768, 7711, 0}, {768, 7713, 0}, {768, 7715, 0}, {768, 7717, 0}, {768, 7719, 0}, {768, 7721, 0},
+        {768, 7723, 0}, {768, 7725, 0}, {768, 7727, 0}, {768, 7729, 0}, {768, 7731, 0}, {768, 7733, 0},
+        {768, 7735, 0}, {768, 7737, 0}, {768, 7739, 0}, {768, 7741, 0}, {768, 7743, 0}, {768, 7745, 0},
+        {768, 7747, 0}, {768, 7749, 0}, {768, 7751, 0}, {768, 7753, 0}, {768, 7755, 0}, {768, 7757, 0},
+        {768, 7759, 0}, {768, 7761, 0}, {768, 7763, 0}, {768, 7765, 0}, {768, 7767, 0}, {768, 7769, 0},
+        {768, 7771, 0}, {768, 7773, 0}, {768, 7775, 0}, {768, 7777, 0}, {768, 7779, 0}, {768, 7781, 0},
+        {768, 7783, 0}, {768, 7785, 0}, {768, 7787, 0}, {768, 7789, 0}, {768, 7791, 0}, {768, 7793, 0},
+        {768, 7795, 0}, {768, 7797, 0}, {768, 7799, 0}, {768, 7801, 0}, {768, 7803, 0}, {768, 7805, 0},
+        {768, 7807, 0}, {768, 7809, 0}, {768, 7811, 0}, {768, 7813, 0}, {768, 7815, 0}, {768, 7817, 0},
+        {768, 7819, 0}, {768, 7821, 0}, {768, 7823, 0}, {768, 7825, 0}, {768, 7827, 0}, {768, 7829, 0},
+        {768, 7831, 0}, {768, 7833, 0}, {768, 7835, 0}, {768, 7837, 0}, {768, 7839, 0}, {768, 7841, 0},
+        {768, 7843, 0}, {768, 7845, 0}, {768, 7847, 0}, {768, 7849, 0}, {768, 7851, 0}, {768, 7853, 0},
+        {768, 7855, 0}, {768, 7857, 0}, {768, 7859, 0}, {768, 7861, 0}, {768, 7863, 0}, {768, 7865, 0},
+        {768, 7867, 0}, {768, 7869, 0}, {768, 7871, 0}, {768, 7873, 0}, {768, 7875, 0}, {768, 7877, 0},
+        {768, 7879, 0}, {768, 7881, 0}, {768, 7883, 0}, {768, 7885, 0}, {768, 7887, 0}, {768, 7889, 0},
+        {768, 7891, 0}, {768, 7893, 0}, {768, 7895, 0}, {768, 7897, 0}, {768, 7899, 0}, {768, 7901, 0},
+        {768, 7903, 0}, {768, 7905, 0}, {768, 7907, 0}, {768, 7909, 0}, {768, 7911, 0}, {768, 7913, 0},
+        {768, 7915, 0}, {768, 7917, 0}, {768, 7919, 0}, {768, 7921, 0}, {768, 7923, 0}, {768, 7925, 0},
+        {768, 7927, 0}, {768, 7929, 0}, {768, 7931, 0}, {768, 7933, 0}, {768, 7935, 0}, {768, 7937, 0},
+        {768, 7939, 0}, {768, 7941, 0}, {768, 7943, 0}, {768, 7945, 0}, {768, 7947, 0}, {768, 7949, 0},
+        {768, 7951, 0}, {768, 7953, 0}, {768, 7955, 0}, {768, 7957, 0}, {768, 7959, 0}, {768, 7961, 0},
+        {768, 7963, 0}, {768, 7965, 0}, {768, 7967, 0}, {768, 7969, 0}, {768, 7971, 0}, {768, 7973, 0},
+        {768, 7975, 0}, {768, 7977, 0}, {768, 7979, 0}, {768, 7981, 0}, {768, 7983, 0}, {768, 7985, 0},
+        {768, 7987, 0}, {768, 7989, 0}, {768, 7991, 0}, {768, 7993, 0}, {768, 7995, 0}, {768, 7997, 0},
+        {768, 7999, 0}, {768, 8001, 0}, {768, 8003, 0}, {768, 8005, 0}, {768, 8007, 0}, {768, 8009, 0},
+        {768, 8011, 0}, {768, 8013, 0}, {768, 8015, 0}, {768, 8017, 0}, {768, 8019, 0}, {768, 8021, 0},
+        {768, 8023, 0}, {768, 8025, 0}, {768, 8027, 0}, {768, 8029, 0}, {768, 8031, 0}, {768, 8033, 0},
+        {768, 8035, 0}, {768, 8037, 0}, {768, 8039, 0}, {768, 8041, 0}, {768, 8043, 0}, {768, 8045, 0},
+        {768, 8047, 0}, {768, 8049, 0}, {768, 8051, 0}, {768, 8053, 0}, {768, 8055, 0}, {768, 8057, 0},
+        {768, 8059, 0}, {768, 8061, 0}, {768, 8063, 0}, {768, 8065, 0}, {768, 8067, 0}, {768, 8069, 0},
+        {768, 8071, 0}, {768, 8073, 0}, {768, 8075, 0}, {768, 8077, 0}, {768, 8079, 0}, {768, 8081, 0},
+        {768, 8083, 0}, {768, 8085, 0}, {768, 8087, 0}, {768, 8089, 0}, {768, 8091, 0}, {768, 8093, 0},
+        {768, 8095, 0}, {768, 8097, 0}, {768, 8099, 0}, {768, 8101, 0}, {768, 8103, 0}, {768, 8105, 0},
+        {768, 8107, 0}, {768, 8109, 0}, {768, 8111, 0}, {768, 8113, 0}, {768, 8115, 0}, {768, 8117, 0},
+        {768, 8119, 0}, {768, 8121, 0}, {768, 8123, 0}, {768, 8125, 0}, {768, 8127, 0}, {768, 8129, 0},
+        {768, 8131, 0}, {768, 8133, 0}, {768, 8135, 0}, {768, 8137, 0}, {768, 8139, 0}, {768, 8141, 0},
+        {768, 8143, 0}, {768, 8145, 0}, {768, 8147, 0}, {768, 8149, 0}, {768, 8151, 0}, {768, 8153, 0},
+        {768, 8155, 0}, {768, 8157, 0}, {768, 8159, 0}, {768, 8161, 0},
+};
+
+/* Sequences of code points, each one is preceded by its length*/
+static const utf8_char32 utf8c_norm_data[8163] = {
+        0, 1, 97, 1, 98, 1, 99, 1, 100, 1, 101, 1, 102, 1, 103, 1,
+        104, 1, 105, 1, 106, 1, 107, 1, 108, 1, 109, 1, 110, 1, 111, 1,
+        112, 1, 113, 1, 114, 1, 115, 1, 116, 1, 117, 1, 118, 1, 119, 1,
+        120, 1, 121, 1, 122, 1, 956, 2, 65, 768, 1, 224, 2, 65, 769, 1,
+        225, 2, 65, 770, 1, 226, 2, 65, 771, 1, 227, 2, 65, 776, 1, 228,
+        2, 65, 778, 1, 229, 1, 230, 2, 67, 807, 1, 231, 2, 69, 768, 1,
+        232, 2, 69, 769, 1, 233, 2, 69, 770, 1, 234, 2, 69, 776, 1, 235,
+        2, 73, 768, 1, 236, 2, 73, 769, 1, 237, 2, 73, 770, 1, 238, 2,
+        73, 776, 1, 239, 1, 240, 2, 78, 771, 1, 241, 2, 79, 768, 1, 242,
+        2, 79, 769, 1, 243, 2, 79, 770, 1, 244, 2, 79, 771, 1, 245, 2,
+        79, 776, 1, 246, 1, 248, 2, 85, 768, 1, 249, 2, 85, 769, 1, 250,
+        2, 85, 770, 1, 251, 2, 85, 776, 1, 252, 2, 89, 769, 1, 253, 1,
+        254, 2, 115, 115, 2, 97, 768, 2, 97, 769, 2, 97, 770, 2, 97, 771,
+        2, 97, 776, 2, 97, 778, 2, 99, 807, 2, 101, 768, 2, 101, 769, 2,
+        101, 770, 2, 101, 776, 2, 105, 768, 2, 105, 769, 2, 105, 770, 2, 105,
+        776, 2, 110, 771, 2, 111, 768, 2, 111, 769, 2, 111, 770, 2, 111, 771,
+        2, 111, 776, 2, 117, 768, 2, 117, 769, 2, 117, 770, 2, 117, 776, 2,
+        121, 769, 2, 121, 776, 2, 65, 772, 1, 257, 2, 97, 772, 2, 65, 774,
+        1, 259, 2, 97, 774, 2, 65, 808, 1, 261, 2, 97, 808, 2, 67, 769,
+        1, 263, 2, 99, 769, 2, 67, 770, 1, 265, 2, 99, 770, 2, 67, 775,
+        1, 267, 2, 99, 775, 2, 67, 780, 1, 269, 2, 99, 780, 2, 68, 780,
+        1, 271, 2, 100, 780, 1, 273, 2, 69, 772, 1, 275, 2, 101, 772, 2,
+        69, 774, 1, 277, 2, 101, 774, 2, 69, 775, 1, 279, 2, 101, 775, 2,
+        69, 808, 1, 281, 2, 101, 808, 2, 69, 780, 1, 283, 2, 101, 780, 2,
+        71, 770, 1, 285, 2, 103, 770, 2, 71, 774, 1, 287, 2, 103, 774, 2,
+        71, 775, 1, 289, 2, 103, 775, 2, 71, 807, 1, 291, 2, 103, 807, 2,
+        72, 770, 1, 293, 2, 104, 770, 1, 295, 2, 73, 771, 1, 297, 2, 105,
+        771, 2, 73, 772, 1, 299, 2, 105, 772, 2, 73, 774, 1, 301, 2, 105,
+        774, 2, 73, 808, 1, 303, 2, 105, 808, 2, 73, 775, 2, 105, 775, 1,
+        307, 2, 74, 770, 1, 309, 2, 106, 770, 2, 75, 807, 1, 311, 2, 107,
+        807, 2, 76, 769, 1, 314, 2, 108, 769, 2, 76, 807, 1, 316, 2, 108,
+        807, 2, 76, 780, 1, 318, 2, 108, 780, 1, 320, 1, 322, 2, 78, 769,
+        1, 324, 2, 110, 769, 2, 78, 807, 1, 326, 2, 110, 807, 2, 78, 780,
+        1, 328, 2, 110, 780, 2, 700, 110, 1, 331, 2, 79, 772, 1, 333, 2,
+        111, 772, 2, 79, 774, 1, 335, 2, 111, 774, 2, 79, 779, 1, 337, 2,
+        111, 779, 1, 339, 2, 82, 769, 1, 341, 2, 114, 769, 2, 82, 807, 1,
+        343, 2, 114, 807, 2, 82, 780, 1, 345, 2, 114, 780, 2, 83, 769, 1,
+        347, 2, 115, 769, 2, 83, 770, 1, 349, 2, 115, 770, 2, 83, 807, 1,
+        351, 2, 115, 807, 2, 83, 780, 1, 353, 2, 115, 780, 2, 84, 807, 1,
+        355, 2, 116, 807, 2, 84, 780, 1, 357, 2, 116, 780, 1, 359, 2, 85,
+        771, 1, 361, 2, 117, 771, 2, 85, 772, 1, 363, 2, 117, 772, 2, 85,
+        774, 1, 365, 2, 117, 774, 2, 85, 778, 1, 367, 2, 117, 778, 2, 85,
+        779, 1, 369, 2, 117, 779, 2, 85, 808, 1, 371, 2, 117, 808, 2, 87,
+        770, 1, 373, 2, 119, 770, 2, 89, 770, 1, 375, 2, 121, 770, 2, 89,
+        776, 1, 255, 2, 90, 769, 1, 378, 2, 122, 769, 2, 90, 775, 1, 380,
+        2, 122, 775, 2, 90, 780, 1, 382, 2, 122, 780, 1, 595, 1, 387, 1,
+        389, 1, 596, 1, 392, 1, 598, 1, 599, 1, 396, 1, 477, 1, 601, 1,
+        603, 1, 402, 1, 608, 1, 611, 1, 617, 1, 616, 1, 409, 1, 623, 1,
+        626, 1, 629, 2, 79, 795, 1, 417, 2, 111, 795, 1, 419, 1, 421, 1,
+        640, 1, 424, 1, 643, 1, 429, 1, 648, 2, 85, 795, 1, 432, 2, 117,
+        795, 1, 650, 1, 651, 1, 436, 1, 438, 1, 658, 1, 441, 1, 445, 1,
+        454, 1, 457, 1, 460, 2, 65, 780, 1, 462, 2, 97, 780, 2, 73, 780,
+        1, 464, 2, 105, 780, 2, 79, 780, 1, 466, 2, 111, 780, 2, 85, 780,
+        1, 468, 2, 117, 780, 3, 85, 776, 772, 1, 470, 3, 117, 776, 772, 3,
+        85, 776, 769, 1, 472, 3, 117, 776, 769, 3, 85, 776, 780, 1, 474, 3,
+        117, 776, 780, 3, 85, 776, 768, 1, 476, 3, 117, 776, 768, 3, 65, 776,
+        772, 1, 479, 3, 97, 776, 772, 3, 65, 775, 772, 1, 481, 3, 97, 775,
+        772, 2, 198, 772, 1, 483, 2, 230, 772, 1, 485, 2, 71, 780, 1, 487,
+        2, 103, 780, 2, 75, 780, 1, 489, 2, 107, 780, 2, 79, 808, 1, 491,
+        2, 111, 808, 3, 79, 808, 772, 1, 493, 3, 111, 808, 772, 2, 439, 780,
+        1, 495, 2, 658, 780, 2, 106, 780, 1, 499, 2, 71, 769, 1, 501, 2,
+        103, 769, 1, 405, 1, 447, 2, 78, 768, 1, 505, 2, 110, 768, 3, 65,
+        778, 769, 1, 507, 3, 97, 778, 769, 2, 198, 769, 1, 509, 2, 230, 769,
+        2, 216, 769, 1, 511, 2, 248, 769, 2, 65, 783, 1, 513, 2, 97, 783,
+        2, 65, 785, 1, 515, 2, 97, 785, 2, 69, 783, 1, 517, 2, 101, 783,
+        2, 69, 785, 1, 519, 2, 101, 785, 2, 73, 783, 1, 521, 2, 105, 783,
+        2, 73, 785, 1, 523, 2, 105, 785, 2, 79, 783, 1, 525, 2, 111, 783,
+        2, 79, 785, 1, 527, 2, 111, 785, 2, 82, 783, 1, 529, 2, 114, 783,
+        2, 82, 785, 1, 531, 2, 114, 785, 2, 85, 783, 1, 533, 2, 117, 783,
+        2, 85, 785, 1, 535, 2, 117, 785, 2, 83, 806, 1, 537, 2, 115, 806,
+        2, 84, 806, 1, 539, 2, 116, 806, 1, 541, 2, 72, 780, 1, 543, 2,
+        104, 780, 1, 414, 1, 547, 1, 549, 2, 65, 775, 1, 551, 2, 97, 775,
+        2, 69, 807, 1, 553, 2, 101, 807, 3, 79, 776, 772, 1, 555, 3, 111,
+        776, 772, 3, 79, 771, 772, 1, 557, 3, 111, 771, 772, 2, 79, 775, 1,
+        559, 2, 111, 775, 3, 79, 775, 772, 1, 561, 3, 111, 775, 772, 2, 89,
+        772, 1, 563, 2, 121, 772, 1, 11365, 1, 572, 1, 410, 1, 11366, 1, 578,
+        1, 384, 1, 649, 1, 652, 1, 583, 1, 585, 1, 587, 1, 589, 1, 591,
+        1, 768, 1, 769, 1, 787, 2, 776, 769, 1, 953, 1, 881, 1, 883, 1,
+        697, 1, 887, 1, 59, 1, 1011, 2, 168, 769, 2, 913, 769, 1, 940, 1,
+        183, 2, 917, 769, 1, 941, 2, 919, 769, 1, 942, 2, 921, 769, 1, 943,
+        2, 927, 769, 1, 972, 2, 933, 769, 1, 973, 2, 937, 769, 1, 974, 3,
+        953, 776, 769, 1, 945, 1, 946, 1, 947, 1, 948, 1, 949, 1, 950, 1,
+        951, 1, 952, 1, 954, 1, 955, 1, 957, 1, 958, 1, 959, 1, 960, 1,
+        961, 1, 963, 1, 964, 1, 965, 1, 966, 1, 967, 1, 968, 1, 969, 2,
+        921, 776, 1, 970, 2, 933, 776, 1, 971, 2, 945, 769, 2, 949, 769, 2,
+        951, 769, 2, 953, 769, 3, 965, 776, 769, 2, 953, 776, 2, 965, 776, 2,
+        959, 769, 2, 965, 769, 2, 969, 769, 1, 983, 2, 978, 769, 2, 978, 776,
+        1, 985, 1, 987, 1, 989, 1, 991, 1, 993, 1, 995, 1, 997, 1, 999,
+        1, 1001, 1, 1003, 1, 1005, 1, 1007, 1, 1016, 1, 1010, 1, 1019, 1, 891,
+        1, 892, 1, 893, 2, 1045, 768, 1, 1104, 2, 1045, 776, 1, 1105, 1, 1106,
+        2, 1043, 769, 1, 1107, 1, 1108, 1, 1109, 1, 1110, 2, 1030, 776, 1, 1111,
+        1, 1112, 1, 1113, 1, 1114, 1, 1115, 2, 1050, 769, 1, 1116, 2, 1048, 768,
+        1, 1117, 2, 1059, 774, 1, 1118, 1, 1119, 1, 1072, 1, 1073, 1, 1074, 1,
+        1075, 1, 1076, 1, 1077, 1, 1078, 1, 1079, 1, 1080, 2, 1048, 774, 1, 1081,
+        1, 1082, 1, 1083, 1, 1084, 1, 1085, 1, 1086, 1, 1087, 1, 1088, 1, 1089,
+        1, 1090, 1, 1091, 1, 1092, 1, 1093, 1, 1094, 1, 1095, 1, 1096, 1, 1097,
+        1, 1098, 1, 1099, 1, 1100, 1, 1101, 1, 1102, 1, 1103, 2, 1080, 774, 2,
+        1077, 768, 2, 1077, 776, 2, 1075, 769, 2, 1110, 776, 2, 1082, 769, 2, 1080,
+        768, 2, 1091, 774, 1, 1121, 1, 1123, 1, 1125, 1, 1127, 1, 1129, 1, 1131,
+        1, 1133, 1, 1135, 1, 1137, 1, 1139, 1, 1141, 2, 1140, 783, 1, 1143, 2,
+        1141, 783, 1, 1145, 1, 1147, 1, 1149, 1, 1151, 1, 1153, 1, 1163, 1, 1165,
+        1, 1167, 1, 1169, 1, 1171, 1, 1173, 1, 1175, 1, 1177, 1, 1179, 1, 1181,
+        1, 1183, 1, 1185, 1, 1187, 1, 1189, 1, 1191, 1, 1193, 1, 1195, 1, 1197,
+        1, 1199, 1, 1201, 1, 1203, 1, 1205, 1, 1207, 1, 1209, 1, 1211, 1, 1213,
+        1, 1215, 1, 1231, 2, 1046, 774, 1, 1218, 2, 1078, 774, 1, 1220, 1, 1222,
+        1, 1224, 1, 1226, 1, 1228, 1, 1230, 2, 1040, 774, 1, 1233, 2, 1072, 774,
+        2, 1040, 776, 1, 1235, 2, 1072, 776, 1, 1237, 2, 1045, 774, 1, 1239, 2,
+        1077, 774, 1, 1241, 2, 1240, 776, 1, 1243, 2, 1241, 776, 2, 1046, 776, 1,
+        1245, 2, 1078, 776, 2, 1047, 776, 1, 1247, 2, 1079, 776, 1, 1249, 2, 1048,
+        772, 1, 1251, 2, 1080, 772, 2, 1048, 776, 1, 1253, 2, 1080, 776, 2, 1054,
+        776, 1, 1255, 2, 1086, 776, 1, 1257, 2, 1256, 776, 1, 1259, 2, 1257, 776,
+        2, 1069, 776, 1, 1261, 2, 1101, 776, 2, 1059, 772, 1, 1263, 2, 1091, 772,
+        2, 1059, 776, 1, 1265, 2, 1091, 776, 2, 1059, 779, 1, 1267, 2, 1091, 779,
+        2, 1063, 776, 1, 1269, 2, 1095, 776, 1, 1271, 2, 1067, 776, 1, 1273, 2,
+        1099, 776, 1, 1275, 1, 1277, 1, 1279, 1, 1281, 1, 1283, 1, 1285, 1, 1287,
+        1, 1289, 1, 1291, 1, 1293, 1, 1295, 1, 1297, 1, 1299, 1, 1301, 1, 1303,
+        1, 1305, 1, 1307, 1, 1309, 1, 1311, 1, 1313, 1, 1315, 1, 1317, 1, 1319,
+        1, 1321, 1, 1323, 1, 1325, 1, 1327, 1, 1377, 1, 1378, 1, 1379, 1, 1380,
+        1, 1381, 1, 1382, 1, 1383, 1, 1384, 1, 1385, 1, 1386, 1, 1387, 1, 1388,
+        1, 1389, 1, 1390, 1, 1391, 1, 1392, 1, 1393, 1, 1394, 1, 1395, 1, 1396,
+        1, 1397, 1, 1398, 1, 1399, 1, 1400, 1, 1401, 1, 1402, 1, 1403, 1, 1404,
+        1, 1405, 1, 1406, 1, 1407, 1, 1408, 1, 1409, 1, 1410, 1, 1411, 1, 1412,
+        1, 1413, 1, 1414, 2, 1381, 1410, 2, 1575, 1619, 2, 1575, 1620, 2, 1608, 1620,
+        2, 1575, 1621, 2, 1610, 1620, 2, 1749, 1620, 2, 1729, 1620, 2, 1746, 1620, 2,
+        2344, 2364, 2, 2352, 2364, 2, 2355, 2364, 2, 2325, 2364, 2, 2326, 2364, 2, 2327,
+        2364, 2, 2332, 2364, 2, 2337, 2364, 2, 2338, 2364, 2, 2347, 2364, 2, 2351, 2364,
+        2, 2503, 2494, 2, 2503, 2519, 2, 2465, 2492, 2, 2466, 2492, 2, 2479, 2492, 2,
+        2610, 2620, 2, 2616, 2620, 2, 2582, 2620, 2, 2583, 2620, 2, 2588, 2620, 2, 2603,
+        2620, 2, 2887, 2902, 2, 2887, 2878, 2, 2887, 2903, 2, 2849, 2876, 2, 2850, 2876,
+        2, 2962, 3031, 2, 3014, 3006, 2, 3015, 3006, 2, 3014, 3031, 2, 3142, 3158, 2,
+        3263, 3285, 2, 3270, 3285, 2, 3270, 3286, 2, 3270, 3266, 3, 3270, 3266, 3285, 2,
+        3398, 3390, 2, 3399, 3390, 2, 3398, 3415, 2, 3545, 3530, 2, 3545, 3535, 3, 3545,
+        3535, 3530, 2, 3545, 3551, 2, 3906, 4023, 2, 3916, 4023, 2, 3921, 4023, 2, 3926,
+        4023, 2, 3931, 4023, 2, 3904, 4021, 2, 3953, 3954, 2, 3953, 3956, 2, 4018, 3968,
+        2, 4019, 3968, 2, 3953, 3968, 2, 3986, 4023, 2, 3996, 4023, 2, 4001, 4023, 2,
+        4006, 4023, 2, 4011, 4023, 2, 3984, 4021, 2, 4133, 4142, 1, 11520, 1, 11521, 1,
+        11522, 1, 11523, 1, 11524, 1, 11525, 1, 11526, 1, 11527, 1, 11528, 1, 11529, 1,
+        11530, 1, 11531, 1, 11532, 1, 11533, 1, 11534, 1, 11535, 1, 11536, 1, 11537, 1,
+        11538, 1, 11539, 1, 11540, 1, 11541, 1, 11542, 1, 11543, 1, 11544, 1, 11545, 1,
+        11546, 1, 11547, 1, 11548, 1, 11549, 1, 11550, 1, 11551, 1, 11552, 1, 11553, 1,
+        11554, 1, 11555, 1, 11556, 1, 11557, 1, 11559, 1, 11565, 1, 5104, 1, 5105, 1,
+        5106, 1, 5107, 1, 5108, 1, 5109, 2, 6917, 6965, 2, 6919, 6965, 2, 6921, 6965,
+        2, 6923, 6965, 2, 6925, 6965, 2, 6929, 6965, 2, 6970, 6965, 2, 6972, 6965, 2,
+        6974, 6965, 2, 6975, 6965, 2, 6978, 6965, 1, 42571, 1, 4304, 1, 4305, 1, 4306,
+        1, 4307, 1, 4308, 1, 4309, 1, 4310, 1, 4311, 1, 4312, 1, 4313, 1, 4314,
+        1, 4315, 1, 4316, 1, 4317, 1, 4318, 1, 4319, 1, 4320, 1, 4321, 1, 4322,
+        1, 4323, 1, 4324, 1, 4325, 1, 4326, 1, 4327, 1, 4328, 1, 4329, 1, 4330,
+        1, 4331, 1, 4332, 1, 4333, 1, 4334, 1, 4335, 1, 4336, 1, 4337, 1, 4338,
+        1, 4339, 1, 4340, 1, 4341, 1, 4342, 1, 4343, 1, 4344, 1, 4345, 1, 4346,
+        1, 4349, 1, 4350, 1, 4351, 2, 65, 805, 1, 7681, 2, 97, 805, 2, 66,
+        775, 1, 7683, 2, 98, 775, 2, 66, 803, 1, 7685, 2, 98, 803, 2, 66,
+        817, 1, 7687, 2, 98, 817, 3, 67, 807, 769, 1, 7689, 3, 99, 807, 769,
+        2, 68, 775, 1, 7691, 2, 100, 775, 2, 68, 803, 1, 7693, 2, 100, 803,
+        2, 68, 817, 1, 7695, 2, 100, 817, 2, 68, 807, 1, 7697, 2, 100, 807,
+        2, 68, 813, 1, 7699, 2, 100, 813, 3, 69, 772, 768, 1, 7701, 3, 101,
+        772, 768, 3, 69, 772, 769, 1, 7703, 3, 101, 772, 769, 2, 69, 813, 1,
+        7705, 2, 101, 813, 2, 69, 816, 1, 7707, 2, 101, 816, 3, 69, 807, 774,
+        1, 7709, 3, 101, 807, 774, 2, 70, 775, 1, 7711, 2, 102, 775, 2, 71,
+        772, 1, 7713, 2, 103, 772, 2, 72, 775, 1, 7715, 2, 104, 775, 2, 72,
+        803, 1, 7717, 2, 104, 803, 2, 72, 776, 1, 7719, 2, 104, 776, 2, 72,
+        807, 1, 7721, 2, 104, 807, 2, 72, 814, 1, 7723, 2, 104, 814, 2, 73,
+        816, 1, 7725, 2, 105, 816, 3, 73, 776, 769, 1, 7727, 3, 105, 776, 769,
+        2, 75, 769, 1, 7729, 2, 107, 769, 2, 75, 803, 1, 7731, 2, 107, 803,
+        2, 75, 817, 1, 7733, 2, 107, 817, 2, 76, 803, 1, 7735, 2, 108, 803,
+        3, 76, 803, 772, 1, 7737, 3, 108, 803, 772, 2, 76, 817, 1, 7739, 2,
+        108, 817, 2, 76, 813, 1, 7741, 2, 108, 813, 2, 77, 769, 1, 7743, 2,
+        109, 769, 2, 77, 775, 1, 7745, 2, 109, 775, 2, 77, 803, 1, 7747, 2,
+        109, 803, 2, 78, 775, 1, 7749, 2, 110, 775, 2, 78, 803, 1, 7751, 2,
+        110, 803, 2, 78, 817, 1, 7753, 2, 110, 817, 2, 78, 813, 1, 7755, 2,
+        110, 813, 3, 79, 771, 769, 1, 7757, 3, 111, 771, 769, 3, 79, 771, 776,
+        1, 7759, 3, 111, 771, 776, 3, 79, 772, 768, 1, 7761, 3, 111, 772, 768,
+        3, 79, 772, 769, 1, 7763, 3, 111, 772, 769, 2, 80, 769, 1, 7765, 2,
+        112, 769, 2, 80, 775, 1, 7767, 2, 112, 775, 2, 82, 775, 1, 7769, 2,
+        114, 775, 2, 82, 803, 1, 7771, 2, 114, 803, 3, 82, 803, 772, 1, 7773,
+        3, 114, 803, 772, 2, 82, 817, 1, 7775, 2, 114, 817, 2, 83, 775, 1,
+        7777, 2, 115, 775, 2, 83, 803, 1, 7779, 2, 115, 803, 3, 83, 769, 775,
+        1, 7781, 3, 115, 769, 775, 3, 83, 780, 775, 1, 7783, 3, 115, 780, 775,
+        3, 83, 803, 775, 1, 7785, 3, 115, 803, 775, 2, 84, 775, 1, 7787, 2,
+        116, 775, 2, 84, 803, 1, 7789, 2, 116, 803, 2, 84, 817, 1, 7791, 2,
+        116, 817, 2, 84, 813, 1, 7793, 2, 116, 813, 2, 85, 804, 1, 7795, 2,
+        117, 804, 2, 85, 816, 1, 7797, 2, 117, 816, 2, 85, 813, 1, 7799, 2,
+        117, 813, 3, 85, 771, 769, 1, 7801, 3, 117, 771, 769, 3, 85, 772, 776,
+        1, 7803, 3, 117, 772, 776, 2, 86, 771, 1, 7805, 2, 118, 771, 2, 86,
+        803, 1, 7807, 2, 118, 803, 2, 87, 768, 1, 7809, 2, 119, 768, 2, 87,
+        769, 1, 7811, 2, 119, 769, 2, 87, 776, 1, 7813, 2, 119, 776, 2, 87,
+        775, 1, 7815, 2, 119, 775, 2, 87, 803, 1, 7817, 2, 119, 803, 2, 88,
+        775, 1, 7819, 2, 120, 775, 2, 88, 776, 1, 7821, 2, 120, 776, 2, 89,
+        775, 1, 7823, 2, 121, 775, 2, 90, 770, 1, 7825, 2, 122, 770, 2, 90,
+        803, 1, 7827, 2, 122, 803, 2, 90, 817, 1, 7829, 2, 122, 817, 2, 104,
+        817, 2, 116, 776, 2, 119, 778, 2, 121, 778, 2, 97, 702, 2, 383, 775,
+        2, 65, 803, 1, 7841, 2, 97, 803, 2, 65, 777, 1, 7843, 2, 97, 777,
+        3, 65, 770, 769, 1, 7845, 3, 97, 770, 769, 3, 65, 770, 768, 1, 7847,
+        3, 97, 770, 768, 3, 65, 770, 777, 1, 7849, 3, 97, 770, 777, 3, 65,
+        770, 771, 1, 7851, 3, 97, 770, 771, 3, 65, 803, 770, 1, 7853, 3, 97,
+        803, 770, 3, 65, 774, 769, 1, 7855, 3, 97, 774, 769, 3, 65, 774, 768,
+        1, 7857, 3, 97, 774, 768, 3, 65, 774, 777, 1, 7859, 3, 97, 774, 777,
+        3, 65, 774, 771, 1, 7861, 3, 97, 774, 771, 3, 65, 803, 774, 1, 7863,
+        3, 97, 803, 774, 2, 69, 803, 1, 7865, 2, 101, 803, 2, 69, 777, 1,
+        7867, 2, 101, 777, 2, 69, 771, 1, 7869, 2, 101, 771, 3, 69, 770, 769,
+        1, 7871, 3, 101, 770, 769, 3, 69, 770, 768, 1, 7873, 3, 101, 770, 768,
+        3, 69, 770, 777, 1, 7875, 3, 101, 770, 777, 3, 69, 770, 771, 1, 7877,
+        3, 101, 770, 771, 3, 69, 803, 770, 1, 7879, 3, 101, 803, 770, 2, 73,
+        777, 1, 7881, 2, 105, 777, 2, 73, 803, 1, 7883, 2, 105, 803, 2, 79,
+        803, 1, 7885, 2, 111, 803, 2, 79, 777, 1, 7887, 2, 111, 777, 3, 79,
+        770, 769, 1, 7889, 3, 111, 770, 769, 3, 79, 770, 768, 1, 7891, 3, 111,
+        770, 768, 3, 79, 770, 777, 1, 7893, 3, 111, 770, 777, 3, 79, 770, 771,
+        1, 7895, 3, 111, 770, 771, 3, 79, 803, 770, 1, 7897, 3, 111, 803, 770,
+        3, 79, 795, 769, 1, 7899, 3, 111, 795, 769, 3, 79, 795, 768, 1, 7901,
+        3, 111, 795, 768, 3, 79, 795, 777, 1, 7903, 3, 111, 795, 777, 3, 79,
+        795, 771, 1, 7905, 3, 111, 795, 771, 3, 79, 795, 803, 1, 7907, 3, 111,
+        795, 803, 2, 85, 803, 1, 7909, 2, 117, 803, 2, 85, 777, 1, 7911, 2,
+        117, 777, 3, 85, 795, 769, 1, 7913, 3, 117, 795, 769, 3, 85, 795, 768,
+        1, 7915, 3, 117, 795, 768, 3, 85, 795, 777, 1, 7917, 3, 117, 795, 777,
+        3, 85, 795, 771, 1, 7919, 3, 117, 795, 771, 3, 85, 795, 803, 1, 7921,
+        3, 117, 795, 803, 2, 89, 768, 1, 7923, 2, 121, 768, 2, 89, 803, 1,
+        7925, 2, 121, 803, 2, 89, 777, 1, 7927, 2, 121, 777, 2, 89, 771, 1,
+        7929, 2, 121, 771, 1, 7931, 1, 7933, 1, 7935, 2, 945, 787, 2, 945, 788,
+        3, 945, 787, 768, 3, 945, 788, 768, 3, 945, 787, 769, 3, 945, 788, 769,
+        3, 945, 787, 834, 3, 945, 788, 834, 2, 913, 787, 1, 7936, 2, 913, 788,
+        1, 7937, 3, 913, 787, 768, 1, 7938, 3, 913, 788, 768, 1, 7939, 3, 913,
+        787, 769, 1, 7940, 3, 913, 788, 769, 1, 7941, 3, 913, 787, 834, 1, 7942,
+        3, 913, 788, 834, 1, 7943, 2, 949, 787, 2, 949, 788, 3, 949, 787, 768,
+        3, 949, 788, 768, 3, 949, 787, 769, 3, 949, 788, 769, 2, 917, 787, 1,
+        7952, 2, 917, 788, 1, 7953, 3, 917, 787, 768, 1, 7954, 3, 917, 788, 768,
+        1, 7955, 3, 917, 787, 769, 1, 7956, 3, 917, 788, 769, 1, 7957, 2, 951,
+        787, 2, 951, 788, 3, 951, 787, 768, 3, 951, 788, 768, 3, 951, 787, 769,
+        3, 951, 788, 769, 3, 951, 787, 834, 3, 951, 788, 834, 2, 919, 787, 1,
+        7968, 2, 919, 788, 1, 7969, 3, 919, 787, 768, 1, 7970, 3, 919, 788, 768,
+        1, 7971, 3, 919, 787, 769, 1, 7972, 3, 919, 788, 769, 1, 7973, 3, 919,
+        787, 834, 1, 7974, 3, 919, 788, 834, 1, 7975, 2, 953, 787, 2, 953, 788,
+        3, 953, 787, 768, 3, 953, 788, 768, 3, 953, 787, 769, 3, 953, 788, 769,
+        3, 953, 787, 834, 3, 953, 788, 834, 2, 921, 787, 1, 7984, 2, 921, 788,
+        1, 7985, 3, 921, 787, 768, 1, 7986, 3, 921, 788, 768, 1, 7987, 3, 921,
+        787, 769, 1, 7988, 3, 921, 788, 769, 1, 7989, 3, 921, 787, 834, 1, 7990,
+        3, 921, 788, 834, 1, 7991, 2, 959, 787, 2, 959, 788, 3, 959, 787, 768,
+        3, 959, 788, 768, 3, 959, 787, 769, 3, 959, 788, 769, 2, 927, 787, 1,
+        8000, 2, 927, 788, 1, 8001, 3, 927, 787, 768, 1, 8002, 3, 927, 788, 768,
+        1, 8003, 3, 927, 787, 769, 1, 8004, 3, 927, 788, 769, 1, 8005, 2, 965,
+        787, 2, 965, 788, 3, 965, 787, 768, 3, 965, 788, 768, 3, 965, 787, 769,
+        3, 965, 788, 769, 3, 965, 787, 834, 3, 965, 788, 834, 2, 933, 788, 1,
+        8017, 3, 933, 788, 768, 1, 8019, 3, 933, 788, 769, 1, 8021, 3, 933, 788,
+        834, 1, 8023, 2, 969, 787, 2, 969, 788, 3, 969, 787, 768, 3, 969, 788,
+        768, 3, 969, 787, 769, 3, 969, 788, 769, 3, 969, 787, 834, 3, 969, 788,
+        834, 2, 937, 787, 1, 8032, 2, 937, 788, 1, 8033, 3, 937, 787, 768, 1,
+        8034, 3, 937, 788, 768, 1, 8035, 3, 937, 787, 769, 1, 8036, 3, 937, 788,
+        769, 1, 8037, 3, 937, 787, 834, 1, 8038, 3, 937, 788, 834, 1, 8039, 2,
+        945, 768, 2, 949, 768, 2, 951, 768, 2, 953, 768, 2, 959, 768, 2, 965,
+        768, 2, 969, 768, 3, 945, 787, 837, 2, 7936, 953, 3, 945, 788, 837, 2,
+        7937, 953, 4, 945, 787, 768, 837, 2, 7938, 953, 4, 945, 788, 768, 837, 2,
+        7939, 953, 4, 945, 787, 769, 837, 2, 7940, 953, 4, 945, 788, 769, 837, 2,
+        7941, 953, 4, 945, 787, 834, 837, 2, 7942, 953, 4, 945, 788, 834, 837, 2,
+        7943, 953, 3, 913, 787, 837, 3, 913, 788, 837, 4, 913, 787, 768, 837, 4,
+        913, 788, 768, 837, 4, 913, 787, 769, 837, 4, 913, 788, 769, 837, 4, 913,
+        787, 834, 837, 4, 913, 788, 834, 837, 3, 951, 787, 837, 2, 7968, 953, 3,
+        951, 788, 837, 2, 7969, 953, 4, 951, 787, 768, 837, 2, 7970, 953, 4, 951,
+        788, 768, 837, 2, 7971, 953, 4, 951, 787, 769, 837, 2, 7972, 953, 4, 951,
+        788, 769, 837, 2, 7973, 953, 4, 951, 787, 834, 837, 2, 7974, 953, 4, 951,
+        788, 834, 837, 2, 7975, 953, 3, 919, 787, 837, 3, 919, 788, 837, 4, 919,
+        787, 768, 837, 4, 919, 788, 768, 837, 4, 919, 787, 769, 837, 4, 919, 788,
+        769, 837, 4, 919, 787, 834, 837, 4, 919, 788, 834, 837, 3, 969, 787, 837,
+        2, 8032, 953, 3, 969, 788, 837, 2, 8033, 953, 4, 969, 787, 768, 837, 2,
+        8034, 953, 4, 969, 788, 768, 837, 2, 8035, 953, 4, 969, 787, 769, 837, 2,
+        8036, 953, 4, 969, 788, 769, 837, 2, 8037, 953, 4, 969, 787, 834, 837, 2,
+        8038, 953, 4, 969, 788, 834, 837, 2, 8039, 953, 3, 937, 787, 837, 3, 937,
+        788, 837, 4, 937, 787, 768, 837, 4, 937, 788, 768, 837, 4, 937, 787, 769,
+        837, 4, 937, 788, 769, 837, 4, 937, 787, 834, 837, 4, 937, 788, 834, 837,
+        2, 945, 774, 2, 945, 772, 3, 945, 768, 837, 2, 8048, 953, 2, 945, 837,
+        2, 945, 953, 3, 945, 769, 837, 2, 940, 953, 2, 945, 834, 3, 945, 834,
+        837, 3, 945, 834, 953, 2, 913, 774, 1, 8112, 2, 913, 772, 1, 8113, 2,
+        913, 768, 1, 8048, 1, 8049, 2, 913, 837, 2, 168, 834, 3, 951, 768, 837,
+        2, 8052, 953, 2, 951, 837, 2, 951, 953, 3, 951, 769, 837, 2, 942, 953,
+        2, 951, 834, 3, 951, 834, 837, 3, 951, 834, 953, 2, 917, 768, 1, 8050,
+        1, 8051, 2, 919, 768, 1, 8052, 1, 8053, 2, 919, 837, 2, 8127, 768, 2,
+        8127, 769, 2, 8127, 834, 2, 953, 774, 2, 953, 772, 3, 953, 776, 768, 2,
+        953, 834, 3, 953, 776, 834, 2, 921, 774, 1, 8144, 2, 921, 772, 1, 8145,
+        2, 921, 768, 1, 8054, 1, 8055, 2, 8190, 768, 2, 8190, 769, 2, 8190, 834,
+        2, 965, 774, 2, 965, 772, 3, 965, 776, 768, 2, 961, 787, 2, 961, 788,
+        2, 965, 834, 3, 965, 776, 834, 2, 933, 774, 1, 8160, 2, 933, 772, 1,
+        8161, 2, 933, 768, 1, 8058, 1, 8059, 2, 929, 788, 1, 8165, 2, 168, 768,
+        1, 96, 3, 969, 768, 837, 2, 8060, 953, 2, 969, 837, 2, 969, 953, 3,
+        969, 769, 837, 2, 974, 953, 2, 969, 834, 3, 969, 834, 837, 3, 969, 834,
+        953, 2, 927, 768, 1, 8056, 1, 8057, 2, 937, 768, 1, 8060, 1, 8061, 2,
+        937, 837, 1, 180, 1, 8194, 1, 8195, 1, 937, 1, 75, 1, 8526, 1, 8560,
+        1, 8561, 1, 8562, 1, 8563, 1, 8564, 1, 8565, 1, 8566, 1, 8567, 1, 8568,
+        1, 8569, 1, 8570, 1, 8571, 1, 8572, 1, 8573, 1, 8574, 1, 8575, 1, 8580,
+        2, 8592, 824, 2, 8594, 824, 2, 8596, 824, 2, 8656, 824, 2, 8660, 824, 2,
+        8658, 824, 2, 8707, 824, 2, 8712, 824, 2, 8715, 824, 2, 8739, 824, 2, 8741,
+        824, 2, 8764, 824, 2, 8771, 824, 2, 8773, 824, 2, 8776, 824, 2, 61, 824,
+        2, 8801, 824, 2, 8781, 824, 2, 60, 824, 2, 62, 824, 2, 8804, 824, 2,
+        8805, 824, 2, 8818, 824, 2, 8819, 824, 2, 8822, 824, 2, 8823, 824, 2, 8826,
+        824, 2, 8827, 824, 2, 8834, 824, 2, 8835, 824, 2, 8838, 824, 2, 8839, 824,
+        2, 8866, 824, 2, 8872, 824, 2, 8873, 824, 2, 8875, 824, 2, 8828, 824, 2,
+        8829, 824, 2, 8849, 824, 2, 8850, 824, 2, 8882, 824, 2, 8883, 824, 2, 8884,
+        824, 2, 8885, 824, 1, 12296, 1, 12297, 1, 9424, 1, 9425, 1, 9426, 1, 9427,
+        1, 9428, 1, 9429, 1, 9430, 1, 9431, 1, 9432, 1, 9433, 1, 9434, 1, 9435,
+        1, 9436, 1, 9437, 1, 9438, 1, 9439, 1, 9440, 1, 9441, 1, 9442, 1, 9443,
+        1, 9444, 1, 9445, 1, 9446, 1, 9447, 1, 9448, 1, 9449, 2, 10973, 824, 1,
+        11312, 1, 11313, 1, 11314, 1, 11315, 1, 11316, 1, 11317, 1, 11318, 1, 11319, 1,
+        11320, 1, 11321, 1, 11322, 1, 11323, 1, 11324, 1, 11325, 1, 11326, 1, 11327, 1,
+        11328, 1, 11329, 1, 11330, 1, 11331, 1, 11332, 1, 11333, 1, 11334, 1, 11335, 1,
+        11336, 1, 11337, 1, 11338, 1, 11339, 1, 11340, 1, 11341, 1, 11342, 1, 11343, 1,
+        11344, 1, 11345, 1, 11346, 1, 11347, 1, 11348, 1, 11349, 1, 11350, 1, 11351, 1,
+        11352, 1, 11353, 1, 11354, 1, 11355, 1, 11356, 1, 11357, 1, 11358, 1, 11359, 1,
+        11361, 1, 619, 1, 7549, 1, 637, 1, 11368, 1, 11370, 1, 11372, 1, 593, 1,
+        625, 1, 592, 1, 594, 1, 11379, 1, 11382, 1, 575, 1, 576, 1, 11393, 1,
+        11395, 1, 11397, 1, 11399, 1, 11401, 1, 11403, 1, 11405, 1, 11407, 1, 11409, 1,
+        11411, 1, 11413, 1, 11415, 1, 11417, 1, 11419, 1, 11421, 1, 11423, 1, 11425, 1,
+        11427, 1, 11429, 1, 11431, 1, 11433, 1, 11435, 1, 11437, 1, 11439, 1, 11441, 1,
+        11443, 1, 11445, 1, 11447, 1, 11449, 1, 11451, 1, 11453, 1, 11455, 1, 11457, 1,
+        11459, 1, 11461, 1, 11463, 1, 11465, 1, 11467, 1, 11469, 1, 11471, 1, 11473, 1,
+        11475, 1, 11477, 1, 11479, 1, 11481, 1, 11483, 1, 11485, 1, 11487, 1, 11489, 1,
+        11491, 1, 11500, 1, 11502, 1, 11507, 2, 12363, 12441, 2, 12365, 12441, 2, 12367, 12441,
+        2, 12369, 12441, 2, 12371, 12441, 2, 12373, 12441, 2, 12375, 12441, 2, 12377, 12441, 2,
+        12379, 12441, 2, 12381, 12441, 2, 12383, 12441, 2, 12385, 12441, 2, 12388, 12441, 2, 12390,
+        12441, 2, 12392, 12441, 2, 12399, 12441, 2, 12399, 12442, 2, 12402, 12441, 2, 12402, 12442,
+        2, 12405, 12441, 2, 12405, 12442, 2, 12408, 12441, 2, 12408, 12442, 2, 12411, 12441, 2,
+        12411, 12442, 2, 12358, 12441, 2, 12445, 12441, 2, 12459, 12441, 2, 12461, 12441, 2, 12463,
+        12441, 2, 12465, 12441, 2, 12467, 12441, 2, 12469, 12441, 2, 12471, 12441, 2, 12473, 12441,
+        2, 12475, 12441, 2, 12477, 12441, 2, 12479, 12441, 2, 12481, 12441, 2, 12484, 12441, 2,
+        12486, 12441, 2, 12488, 12441, 2, 12495, 12441, 2, 12495, 12442, 2, 12498, 12441, 2, 12498,
+        12442, 2, 12501, 12441, 2, 12501, 12442, 2, 12504, 12441, 2, 12504, 12442, 2, 12507, 12441,
+        2, 12507, 12442, 2, 12454, 12441, 2, 12527, 12441, 2, 12528, 12441, 2, 12529, 12441, 2,
+        12530, 12441, 2, 12541, 12441, 1, 42561, 1, 42563, 1, 42565, 1, 42567, 1, 42569, 1,
+        42573, 1, 42575, 1, 42577, 1, 42579, 1, 42581, 1, 42583, 1, 42585, 1, 42587, 1,
+        42589, 1, 42591, 1, 42593, 1, 42595, 1, 42597, 1, 42599, 1, 42601, 1, 42603, 1,
+        42605, 1, 42625, 1, 42627, 1, 42629, 1, 42631, 1, 42633, 1, 42635, 1, 42637, 1,
+        42639, 1, 42641, 1, 42643, 1, 42645, 1, 42647, 1, 42649, 1, 42651, 1, 42787, 1,
+        42789, 1, 42791, 1, 42793, 1, 42795, 1, 42797, 1, 42799, 1, 42803, 1, 42805, 1,
+        42807, 1, 42809, 1, 42811, 1, 42813, 1, 42815, 1, 42817, 1, 42819, 1, 42821, 1,
+        42823, 1, 42825, 1, 42827, 1, 42829, 1, 42831, 1, 42833, 1, 42835, 1, 42837, 1,
+        42839, 1, 42841, 1, 42843, 1, 42845, 1, 42847, 1, 42849, 1, 42851, 1, 42853, 1,
+        42855, 1, 42857, 1, 42859, 1, 42861, 1, 42863, 1, 42874, 1, 42876, 1, 7545, 1,
+        42879, 1, 42881, 1, 42883, 1, 42885, 1, 42887, 1, 42892, 1, 613, 1, 42897, 1,
+        42899, 1, 42903, 1, 42905, 1, 42907, 1, 42909, 1, 42911, 1, 42913, 1, 42915, 1,
+        42917, 1, 42919, 1, 42921, 1, 614, 1, 604, 1, 609, 1, 620, 1, 618, 1,
+        670, 1, 647, 1, 669, 1, 43859, 1, 42933, 1, 42935, 1, 42937, 1, 42939, 1,
+        42941, 1, 42943, 1, 42945, 1, 42947, 1, 42900, 1, 642, 1, 7566, 1, 42952, 1,
+        42954, 1, 42961, 1, 42967, 1, 42969, 1, 42998, 1, 5024, 1, 5025, 1, 5026, 1,
+        5027, 1, 5028, 1, 5029, 1, 5030, 1, 5031, 1, 5032, 1, 5033, 1, 5034, 1,
+        5035, 1, 5036, 1, 5037, 1, 5038, 1, 5039, 1, 5040, 1, 5041, 1, 5042, 1,
+        5043, 1, 5044, 1, 5045, 1, 5046, 1, 5047, 1, 5048, 1, 5049, 1, 5050, 1,
+        5051, 1, 5052, 1, 5053, 1, 5054, 1, 5055, 1, 5056, 1, 5057, 1, 5058, 1,
+        5059, 1, 5060, 1, 5061, 1, 5062, 1, 5063, 1, 5064, 1, 5065, 1, 5066, 1,
+        5067, 1, 5068, 1, 5069, 1, 5070, 1, 5071, 1, 5072, 1, 5073, 1, 5074, 1,
+        5075, 1, 5076, 1, 5077, 1, 5078, 1, 5079, 1, 5080, 1, 5081, 1, 5082, 1,
+        5083, 1, 5084, 1, 5085, 1, 5086, 1, 5087, 1, 5088, 1, 5089, 1, 5090, 1,
+        5091, 1, 5092, 1, 5093, 1, 5094, 1, 5095, 1, 5096, 1, 5097, 1, 5098, 1,
+        5099, 1, 5100, 1, 5101, 1, 5102, 1, 5103, 1, 35912, 1, 26356, 1, 36554, 1,
+        36040, 1, 28369, 1, 20018, 1, 21477, 1, 40860, 1, 22865, 1, 37329, 1, 21895, 1,
+        22856, 1, 25078, 1, 30313, 1, 32645, 1, 34367, 1, 34746, 1, 35064, 1, 37007, 1,
+        27138, 1, 27931, 1, 28889, 1, 29662, 1, 33853, 1, 37226, 1, 39409, 1, 20098, 1,
+        21365, 1, 27396, 1, 29211, 1, 34349, 1, 40478, 1, 23888, 1, 28651, 1, 34253, 1,
+        35172, 1, 25289, 1, 33240, 1, 34847, 1, 24266, 1, 26391, 1, 28010, 1, 29436, 1,
+        37070, 1, 20358, 1, 20919, 1, 21214, 1, 25796, 1, 27347, 1, 29200, 1, 30439, 1,
+        32769, 1, 34310, 1, 34396, 1, 36335, 1, 38706, 1, 39791, 1, 40442, 1, 30860, 1,
+        31103, 1, 32160, 1, 33737, 1, 37636, 1, 40575, 1, 35542, 1, 22751, 1, 24324, 1,
+        31840, 1, 32894, 1, 29282, 1, 30922, 1, 36034, 1, 38647, 1, 22744, 1, 23650, 1,
+        27155, 1, 28122, 1, 28431, 1, 32047, 1, 32311, 1, 38475, 1, 21202, 1, 32907, 1,
+        20956, 1, 20940, 1, 31260, 1, 32190, 1, 33777, 1, 38517, 1, 35712, 1, 25295, 1,
+        35582, 1, 20025, 1, 23527, 1, 24594, 1, 29575, 1, 30064, 1, 21271, 1, 30971, 1,
+        20415, 1, 24489, 1, 19981, 1, 27852, 1, 25976, 1, 32034, 1, 21443, 1, 22622, 1,
+        30465, 1, 33865, 1, 35498, 1, 27578, 1, 36784, 1, 27784, 1, 25342, 1, 33509, 1,
+        25504, 1, 30053, 1, 20142, 1, 20841, 1, 20937, 1, 26753, 1, 31975, 1, 33391, 1,
+        35538, 1, 37327, 1, 21237, 1, 21570, 1, 22899, 1, 24300, 1, 26053, 1, 28670, 1,
+        31018, 1, 38317, 1, 39530, 1, 40599, 1, 40654, 1, 21147, 1, 26310, 1, 27511, 1,
+        36706, 1, 24180, 1, 24976, 1, 25088, 1, 25754, 1, 28451, 1, 29001, 1, 29833, 1,
+        31178, 1, 32244, 1, 32879, 1, 36646, 1, 34030, 1, 36899, 1, 37706, 1, 21015, 1,
+        21155, 1, 21693, 1, 28872, 1, 35010, 1, 24265, 1, 24565, 1, 25467, 1, 27566, 1,
+        31806, 1, 29557, 1, 20196, 1, 22265, 1, 23994, 1, 24604, 1, 29618, 1, 29801, 1,
+        32666, 1, 32838, 1, 37428, 1, 38646, 1, 38728, 1, 38936, 1, 20363, 1, 31150, 1,
+        37300, 1, 38584, 1, 24801, 1, 20102, 1, 20698, 1, 23534, 1, 23615, 1, 26009, 1,
+        29134, 1, 30274, 1, 34044, 1, 36988, 1, 40845, 1, 26248, 1, 38446, 1, 21129, 1,
+        26491, 1, 26611, 1, 27969, 1, 28316, 1, 29705, 1, 30041, 1, 30827, 1, 32016, 1,
+        39006, 1, 20845, 1, 25134, 1, 38520, 1, 20523, 1, 23833, 1, 28138, 1, 36650, 1,
+        24459, 1, 24900, 1, 26647, 1, 38534, 1, 21033, 1, 21519, 1, 23653, 1, 26131, 1,
+        26446, 1, 26792, 1, 27877, 1, 29702, 1, 30178, 1, 32633, 1, 35023, 1, 35041, 1,
+        37324, 1, 38626, 1, 21311, 1, 28346, 1, 21533, 1, 29136, 1, 29848, 1, 34298, 1,
+        38563, 1, 40023, 1, 40607, 1, 26519, 1, 28107, 1, 33256, 1, 31435, 1, 31520, 1,
+        31890, 1, 29376, 1, 28825, 1, 35672, 1, 20160, 1, 33590, 1, 21050, 1, 20999, 1,
+        24230, 1, 25299, 1, 31958, 1, 23429, 1, 27934, 1, 26292, 1, 36667, 1, 34892, 1,
+        38477, 1, 35211, 1, 24275, 1, 20800, 1, 21952, 1, 22618, 1, 26228, 1, 20958, 1,
+        29482, 1, 30410, 1, 31036, 1, 31070, 1, 31077, 1, 31119, 1, 38742, 1, 31934, 1,
+        32701, 1, 34322, 1, 35576, 1, 36920, 1, 37117, 1, 39151, 1, 39164, 1, 39208, 1,
+        40372, 1, 37086, 1, 38583, 1, 20398, 1, 20711, 1, 20813, 1, 21193, 1, 21220, 1,
+        21329, 1, 21917, 1, 22022, 1, 22120, 1, 22592, 1, 22696, 1, 23652, 1, 23662, 1,
+        24724, 1, 24936, 1, 24974, 1, 25074, 1, 25935, 1, 26082, 1, 26257, 1, 26757, 1,
+        28023, 1, 28186, 1, 28450, 1, 29038, 1, 29227, 1, 29730, 1, 30865, 1, 31038, 1,
+        31049, 1, 31048, 1, 31056, 1, 31062, 1, 31069, 1, 31117, 1, 31118, 1, 31296, 1,
+        31361, 1, 31680, 1, 32265, 1, 32321, 1, 32626, 1, 32773, 1, 33261, 1, 33401, 1,
+        33879, 1, 35088, 1, 35222, 1, 35585, 1, 35641, 1, 36051, 1, 36104, 1, 36790, 1,
+        38627, 1, 38911, 1, 38971, 1, 24693, 1, 148206, 1, 33304, 1, 20006, 1, 20917, 1,
+        20840, 1, 20352, 1, 20805, 1, 20864, 1, 21191, 1, 21242, 1, 21845, 1, 21913, 1,
+        21986, 1, 22707, 1, 22852, 1, 22868, 1, 23138, 1, 23336, 1, 24274, 1, 24281, 1,
+        24425, 1, 24493, 1, 24792, 1, 24910, 1, 24840, 1, 24928, 1, 25140, 1, 25540, 1,
+        25628, 1, 25682, 1, 25942, 1, 26395, 1, 26454, 1, 27513, 1, 28379, 1, 28363, 1,
+        28702, 1, 30631, 1, 29237, 1, 29359, 1, 29809, 1, 29958, 1, 30011, 1, 30237, 1,
+        30239, 1, 30427, 1, 30452, 1, 30538, 1, 30528, 1, 30924, 1, 31409, 1, 31867, 1,
+        32091, 1, 32574, 1, 33618, 1, 33775, 1, 34681, 1, 35137, 1, 35206, 1, 35519, 1,
+        35531, 1, 35565, 1, 35722, 1, 36664, 1, 36978, 1, 37273, 1, 37494, 1, 38524, 1,
+        38875, 1, 38923, 1, 39698, 1, 141386, 1, 141380, 1, 144341, 1, 15261, 1, 16408, 1,
+        16441, 1, 152137, 1, 154832, 1, 163539, 1, 40771, 1, 40846, 2, 102, 102, 2, 102,
+        105, 2, 102, 108, 3, 102, 102, 105, 3, 102, 102, 108, 2, 115, 116, 2,
+        1396, 1398, 2, 1396, 1381, 2, 1396, 1387, 2, 1406, 1398, 2, 1396, 1389, 2, 1497,
+        1460, 2, 1522, 1463, 2, 1513, 1473, 2, 1513, 1474, 3, 1513, 1468, 1473, 3, 1513,
+        1468, 1474, 2, 1488, 1463, 2, 1488, 1464, 2, 1488, 1468, 2, 1489, 1468, 2, 1490,
+        1468, 2, 1491, 1468, 2, 1492, 1468, 2, 1493, 1468, 2, 1494, 1468, 2, 1496, 1468,
+        2, 1497, 1468, 2, 1498, 1468, 2, 1499, 1468, 2, 1500, 1468, 2, 1502, 1468, 2,
+        1504, 1468, 2, 1505, 1468, 2, 1507, 1468, 2, 1508, 1468, 2, 1510, 1468, 2, 1511,
+        1468, 2, 1512, 1468, 2, 1513, 1468, 2, 1514, 1468, 2, 1493, 1465, 2, 1489, 1471,
+        2, 1499, 1471, 2, 1508, 1471, 1, 65345, 1, 65346, 1, 65347, 1, 65348, 1, 65349,
+        1, 65350, 1, 65351, 1, 65352, 1, 65353, 1, 65354, 1, 65355, 1, 65356, 1, 65357,
+        1, 65358, 1, 65359, 1, 65360, 1, 65361, 1, 65362, 1, 65363, 1, 65364, 1, 65365,
+        1, 65366, 1, 65367, 1, 65368, 1, 65369, 1, 65370, 1, 66600, 1, 66601, 1, 66602,
+        1, 66603, 1, 66604, 1, 66605, 1, 66606, 1, 66607, 1, 66608, 1, 66609, 1, 66610,
+        1, 66611, 1, 66612, 1, 66613, 1, 66614, 1, 66615, 1, 66616, 1, 66617, 1, 66618,
+        1, 66619, 1, 66620, 1, 66621, 1, 66622, 1, 66623, 1, 66624, 1, 66625, 1, 66626,
+        1, 66627, 1, 66628, 1, 66629, 1, 66630, 1, 66631, 1, 66632, 1, 66633, 1, 66634,
+        1, 66635, 1, 66636, 1, 66637, 1, 66638, 1, 66639, 1, 66776, 1, 66777, 1, 66778,
+        1, 66779, 1, 66780, 1, 66781, 1, 66782, 1, 66783, 1, 66784, 1, 66785, 1, 66786,
+        1, 66787, 1, 66788, 1, 66789, 1, 66790, 1, 66791, 1, 66792, 1, 66793, 1, 66794,
+        1, 66795, 1, 66796, 1, 66797, 1, 66798, 1, 66799, 1, 66800, 1, 66801, 1, 66802,
+        1, 66803, 1, 66804, 1, 66805, 1, 66806, 1, 66807, 1, 66808, 1, 66809, 1, 66810,
+        1, 66811, 1, 66967, 1, 66968, 1, 66969, 1, 66970, 1, 66971, 1, 66972, 1, 66973,
+        1, 66974, 1, 66975, 1, 66976, 1, 66977, 1, 66979, 1, 66980, 1, 66981, 1, 66982,
+        1, 66983, 1, 66984, 1, 66985, 1, 66986, 1, 66987, 1, 66988, 1, 66989, 1, 66990,
+        1, 66991, 1, 66992, 1, 66993, 1, 66995, 1, 66996, 1, 66997, 1, 66998, 1, 66999,
+        1, 67000, 1, 67001, 1, 67003, 1, 67004, 1, 68800, 1, 68801, 1, 68802, 1, 68803,
+        1, 68804, 1, 68805, 1, 68806, 1, 68807, 1, 68808, 1, 68809, 1, 68810, 1, 68811,
+        1, 68812, 1, 68813, 1, 68814, 1, 68815, 1, 68816, 1, 68817, 1, 68818, 1, 68819,
+        1, 68820, 1, 68821, 1, 68822, 1, 68823, 1, 68824, 1, 68825, 1, 68826, 1, 68827,
+        1, 68828, 1, 68829, 1, 68830, 1, 68831, 1, 68832, 1, 68833, 1, 68834, 1, 68835,
+        1, 68836, 1, 68837, 1, 68838, 1, 68839, 1, 68840, 1, 68841, 1, 68842, 1, 68843,
+        1, 68844, 1, 68845, 1, 68846, 1, 68847, 1, 68848, 1, 68849, 1, 68850, 2, 69785,
+        69818, 2, 69787, 69818, 2, 69797, 69818, 2, 69937, 69927, 2, 69938, 69927, 2, 70471, 70462,
+        2, 70471, 70487, 2, 70841, 70842, 2, 70841, 70832, 2, 70841, 70845, 2, 71096, 71087, 2,
+        71097, 71087, 1, 71872, 1, 71873, 1, 71874, 1, 71875, 1, 71876, 1, 71877, 1, 71878,
+        1, 71879, 1, 71880, 1, 71881, 1, 71882, 1, 71883, 1, 71884, 1, 71885, 1, 71886,
+        1, 71887, 1, 71888, 1, 71889, 1, 71890, 1, 71891, 1, 71892, 1, 71893, 1, 71894,
+        1, 71895, 1, 71896, 1, 71897, 1, 71898, 1, 71899, 1, 71900, 1, 71901, 1, 71902,
+        1, 71903, 2, 71989, 71984, 1, 93792, 1, 93793, 1, 93794, 1, 93795, 1, 93796, 1,
+        93797, 1, 93798, 1, 93799, 1, 93800, 1, 93801, 1, 93802, 1, 93803, 1, 93804, 1,
+        93805, 1, 93806, 1, 93807, 1, 93808, 1, 93809, 1, 93810, 1, 93811, 1, 93812, 1,
+        93813, 1, 93814, 1, 93815, 1, 93816, 1, 93817, 1, 93818, 1, 93819, 1, 93820, 1,
+        93821, 1, 93822, 1, 93823, 2, 119127, 119141, 2, 119128, 119141, 3, 119128, 119141, 119150, 3,
+        119128, 119141, 119151, 3, 119128, 119141, 119152, 3, 119128, 119141, 119153, 3, 119128, 119141, 119154, 2,
+        119225, 119141, 2, 119226, 119141, 3, 119225, 119141, 119150, 3, 119226, 119141, 119150, 3, 119225, 119141,
+        119151, 3, 119226, 119141, 119151, 1, 125218, 1, 125219, 1, 125220, 1, 125221, 1, 125222, 1,
+        125223, 1, 125224, 1, 125225, 1, 125226, 1, 125227, 1, 125228, 1, 125229, 1, 125230, 1,
+        125231, 1, 125232, 1, 125233, 1, 125234, 1, 125235, 1, 125236, 1, 125237, 1, 125238, 1,
+        125239, 1, 125240, 1, 125241, 1, 125242, 1, 125243, 1, 125244, 1, 125245, 1, 125246, 1,
+        125247, 1, 125248, 1, 125249, 1, 125250, 1, 125251, 1, 20029, 1, 20024, 1, 20033, 1,
+        131362, 1, 20320, 1, 20411, 1, 20482, 1, 20602, 1, 20633, 1, 20687, 1, 13470, 1,
+        132666, 1, 20820, 1, 20836, 1, 20855, 1, 132380, 1, 13497, 1, 20839, 1, 20877, 1,
+        132427, 1, 20887, 1, 20900, 1, 20172, 1, 20908, 1, 168415, 1, 20981, 1, 20995, 1,
+        13535, 1, 21051, 1, 21062, 1, 21106, 1, 21111, 1, 13589, 1, 21253, 1, 21254, 1,
+        21321, 1, 21338, 1, 21363, 1, 21373, 1, 21375, 1, 133676, 1, 28784, 1, 21450, 1,
+        21471, 1, 133987, 1, 21483, 1, 21489, 1, 21510, 1, 21662, 1, 21560, 1, 21576, 1,
+        21608, 1, 21666, 1, 21750, 1, 21776, 1, 21843, 1, 21859, 1, 21892, 1, 21931, 1,
+        21939, 1, 21954, 1, 22294, 1, 22295, 1, 22097, 1, 22132, 1, 22766, 1, 22478, 1,
+        22516, 1, 22541, 1, 22411, 1, 22578, 1, 22577, 1, 22700, 1, 136420, 1, 22770, 1,
+        22775, 1, 22790, 1, 22810, 1, 22818, 1, 22882, 1, 136872, 1, 136938, 1, 23020, 1,
+        23067, 1, 23079, 1, 23000, 1, 23142, 1, 14062, 1, 14076, 1, 23304, 1, 23358, 1,
+        137672, 1, 23491, 1, 23512, 1, 23539, 1, 138008, 1, 23551, 1, 23558, 1, 24403, 1,
+        23586, 1, 14209, 1, 23648, 1, 23744, 1, 23693, 1, 138724, 1, 23875, 1, 138726, 1,
+        23918, 1, 23915, 1, 23932, 1, 24033, 1, 24034, 1, 14383, 1, 24061, 1, 24104, 1,
+        24125, 1, 24169, 1, 14434, 1, 139651, 1, 14460, 1, 24240, 1, 24243, 1, 24246, 1,
+        172946, 1, 24318, 1, 140081, 1, 33281, 1, 24354, 1, 14535, 1, 144056, 1, 156122, 1,
+        24418, 1, 24427, 1, 14563, 1, 24474, 1, 24525, 1, 24535, 1, 24569, 1, 24705, 1,
+        14650, 1, 14620, 1, 141012, 1, 24775, 1, 24904, 1, 24908, 1, 24954, 1, 25010, 1,
+        24996, 1, 25007, 1, 25054, 1, 25104, 1, 25115, 1, 25181, 1, 25265, 1, 25300, 1,
+        25424, 1, 142092, 1, 25405, 1, 25340, 1, 25448, 1, 25475, 1, 25572, 1, 142321, 1,
+        25634, 1, 25541, 1, 25513, 1, 14894, 1, 25705, 1, 25726, 1, 25757, 1, 25719, 1,
+        14956, 1, 25964, 1, 143370, 1, 26083, 1, 26360, 1, 26185, 1, 15129, 1, 15112, 1,
+        15076, 1, 20882, 1, 20885, 1, 26368, 1, 26268, 1, 32941, 1, 17369, 1, 26401, 1,
+        26462, 1, 26451, 1, 144323, 1, 15177, 1, 26618, 1, 26501, 1, 26706, 1, 144493, 1,
+        26766, 1, 26655, 1, 26900, 1, 26946, 1, 27043, 1, 27114, 1, 27304, 1, 145059, 1,
+        27355, 1, 15384, 1, 27425, 1, 145575, 1, 27476, 1, 15438, 1, 27506, 1, 27551, 1,
+        27579, 1, 146061, 1, 138507, 1, 146170, 1, 27726, 1, 146620, 1, 27839, 1, 27853, 1,
+        27751, 1, 27926, 1, 27966, 1, 28009, 1, 28024, 1, 28037, 1, 146718, 1, 27956, 1,
+        28207, 1, 28270, 1, 15667, 1, 28359, 1, 147153, 1, 28153, 1, 28526, 1, 147294, 1,
+        147342, 1, 28614, 1, 28729, 1, 28699, 1, 15766, 1, 28746, 1, 28797, 1, 28791, 1,
+        28845, 1, 132389, 1, 28997, 1, 148067, 1, 29084, 1, 148395, 1, 29224, 1, 29264, 1,
+        149000, 1, 29312, 1, 29333, 1, 149301, 1, 149524, 1, 29562, 1, 29579, 1, 16044, 1,
+        29605, 1, 16056, 1, 29767, 1, 29788, 1, 29829, 1, 29898, 1, 16155, 1, 29988, 1,
+        150582, 1, 30014, 1, 150674, 1, 139679, 1, 30224, 1, 151457, 1, 151480, 1, 151620, 1,
+        16380, 1, 16392, 1, 151795, 1, 151794, 1, 151833, 1, 151859, 1, 30494, 1, 30495, 1,
+        30603, 1, 16454, 1, 16534, 1, 152605, 1, 30798, 1, 16611, 1, 153126, 1, 153242, 1,
+        153285, 1, 31211, 1, 16687, 1, 31306, 1, 31311, 1, 153980, 1, 154279, 1, 31470, 1,
+        16898, 1, 154539, 1, 31686, 1, 31689, 1, 16935, 1, 154752, 1, 31954, 1, 17056, 1,
+        31976, 1, 31971, 1, 32000, 1, 155526, 1, 32099, 1, 17153, 1, 32199, 1, 32258, 1,
+        32325, 1, 17204, 1, 156200, 1, 156231, 1, 17241, 1, 156377, 1, 32634, 1, 156478, 1,
+        32661, 1, 32762, 1, 156890, 1, 156963, 1, 32864, 1, 157096, 1, 32880, 1, 144223, 1,
+        17365, 1, 32946, 1, 33027, 1, 17419, 1, 33086, 1, 23221, 1, 157607, 1, 157621, 1,
+        144275, 1, 144284, 1, 33284, 1, 36766, 1, 17515, 1, 33425, 1, 33419, 1, 33437, 1,
+        21171, 1, 33457, 1, 33459, 1, 33469, 1, 33510, 1, 158524, 1, 33565, 1, 33635, 1,
+        33709, 1, 33571, 1, 33725, 1, 33767, 1, 33619, 1, 33738, 1, 33740, 1, 33756, 1,
+        158774, 1, 159083, 1, 158933, 1, 17707, 1, 34033, 1, 34035, 1, 34070, 1, 160714, 1,
+        34148, 1, 159532, 1, 17757, 1, 17761, 1, 159665, 1, 159954, 1, 17771, 1, 34384, 1,
+        34407, 1, 34409, 1, 34473, 1, 34440, 1, 34574, 1, 34530, 1, 34600, 1, 34667, 1,
+        34694, 1, 17879, 1, 34785, 1, 34817, 1, 17913, 1, 34912, 1, 34915, 1, 161383, 1,
+        35031, 1, 35038, 1, 17973, 1, 35066, 1, 13499, 1, 161966, 1, 162150, 1, 18110, 1,
+        18119, 1, 35488, 1, 35925, 1, 162984, 1, 36011, 1, 36033, 1, 36123, 1, 36215, 1,
+        163631, 1, 133124, 1, 36299, 1, 36284, 1, 36336, 1, 133342, 1, 36564, 1, 165330, 1,
+        165357, 1, 37012, 1, 37105, 1, 37137, 1, 165678, 1, 37147, 1, 37432, 1, 37591, 1,
+        37592, 1, 37500, 1, 37881, 1, 37909, 1, 166906, 1, 38283, 1, 18837, 1, 38327, 1,
+        167287, 1, 18918, 1, 38595, 1, 23986, 1, 38691, 1, 168261, 1, 168474, 1, 19054, 1,
+        19062, 1, 38880, 1, 168970, 1, 19122, 1, 169110, 1, 38953, 1, 169398, 1, 39138, 1,
+        19251, 1, 39209, 1, 39335, 1, 39362, 1, 39422, 1, 19406, 1, 170800, 1, 40000, 1,
+        40189, 1, 19662, 1, 19693, 1, 40295, 1, 172238, 1, 19704, 1, 172293, 1, 172558, 1,
+        172689, 1, 40635, 1, 19798, 1, 40697, 1, 40702, 1, 40709, 1, 40719, 1, 40726, 1,
+        40763, 1, 173568,
+};
+
+/* Primary composites, sorted by the first and then by the second code point of their decomposition*/
+static const utf8_char32 utf8c_norm_compose[941][3] = {
+        {60, 824, 8814}, {61, 824, 8800}, {62, 824, 8815}, {65, 768, 192},
+        {65, 769, 193}, {65, 770, 194}, {65, 771, 195}, {65, 772, 256},
+        {65, 774, 258}, {65, 775, 550}, {65, 776, 196}, {65, 777, 7842},
+        {65, 778, 197}, {65, 780, 461}, {65, 783, 512}, {65, 785, 514},
+        {65, 803, 7840}, {65, 805, 7680}, {65, 808, 260}, {66, 775, 7682},
+        {66, 803, 7684}, {66, 817, 7686}, {67, 769, 262}, {67, 770, 264},
+        {67, 775, 266}, {67, 780, 268}, {67, 807, 199}, {68, 775, 7690},
+        {68, 780, 270}, {68, 803, 7692}, {68, 807, 7696}, {68, 813, 7698},
+        {68, 817, 7694}, {69, 768, 200}, {69, 769, 201}, {69, 770, 202},
+        {69, 771, 7868}, {69, 772, 274}, {69, 774, 276}, {69, 775, 278},
+        {69, 776, 203}, {69, 777, 7866}, {69, 780, 282}, {69, 783, 516},
+        {69, 785, 518}, {69, 803, 7864}, {69, 807, 552}, {69, 808, 280},
+        {69, 813, 7704}, {69, 816, 7706}, {70, 775, 7710}, {71, 769, 500},
+        {71, 770, 284}, {71, 772, 7712}, {71, 774, 286}, {71, 775, 288},
+        {71, 780, 486}, {71, 807, 290}, {72, 770, 292}, {72, 775, 7714},
+        {72, 776, 7718}, {72, 780, 542}, {72, 803, 7716}, {72, 807, 7720},
+        {72, 814, 7722}, {73, 768, 204}, {73, 769, 205}, {73, 770, 206},
+        {73, 771, 296}, {73, 772, 298}, {73, 774, 300}, {73, 775, 304},
+        {73, 776, 207}, {73, 777, 7880}, {73, 780, 463}, {73, 783, 520},
+        {73, 785, 522}, {73, 803, 7882}, {73, 808, 302}, {73, 816, 7724},
+        {74, 770, 308}, {75, 769, 7728}, {75, 780, 488}, {75, 803, 7730},
+        {75, 807, 310}, {75, 817, 7732}, {76, 769, 313}, {76, 780, 317},
+        {76, 803, 7734}, {76, 807, 315}, {76, 813, 7740}, {76, 817, 7738},
+        {77, 769, 7742}, {77, 775, 7744}, {77, 803, 7746}, {78, 768, 504},
+        {78, 769, 323}, {78, 771, 209}, {78, 775, 7748}, {78, 780, 327},
+        {78, 803, 7750}, {78, 807, 325}, {78, 813, 7754}, {78, 817, 7752},
+        {79, 768, 210}, {79, 769, 211}, {79, 770, 212}, {79, 771, 213},
+        {79, 772, 332}, {79, 774, 334}, {79, 775, 558}, {79, 776, 214},
+        {79, 777, 7886}, {79, 779, 336}, {79, 780, 465}, {79, 783, 524},
+        {79, 785, 526}, {79, 795, 416}, {79, 803, 7884}, {79, 808, 490},
+        {80, 769, 7764}, {80, 775, 7766}, {82, 769, 340}, {82, 775, 7768},
+        {82, 780, 344}, {82, 783, 528}, {82, 785, 530}, {82, 803, 7770},
+        {82, 807, 342}, {82, 817, 7774}, {83, 769, 346}, {83, 770, 348},
+        {83, 775, 7776}, {83, 780, 352}, {83, 803, 7778}, {83, 806, 536},
+        {83, 807, 350}, {84, 775, 7786}, {84, 780, 356}, {84, 803, 7788},
+        {84, 806, 538}, {84, 807, 354}, {84, 813, 7792}, {84, 817, 7790},
+        {85, 768, 217}, {85, 769, 218}, {85, 770, 219}, {85, 771, 360},
+        {85, 772, 362}, {85, 774, 364}, {85, 776, 220}, {85, 777, 7910},
+        {85, 778, 366}, {85, 779, 368}, {85, 780, 467}, {85, 783, 532},
+        {85, 785, 534}, {85, 795, 431}, {85, 803, 7908}, {85, 804, 7794},
+        {85, 808, 370}, {85, 813, 7798}, {85, 816, 7796}, {86, 771, 7804},
+        {86, 803, 7806}, {87, 768, 7808}, {87, 769, 7810}, {87, 770, 372},
+        {87, 775, 7814}, {87, 776, 7812}, {87, 803, 7816}, {88, 775, 7818},
+        {88, 776, 7820}, {89, 768, 7922}, {89, 769, 221}, {89, 770, 374},
+        {89, 771, 7928}, {89, 772, 562}, {89, 775, 7822}, {89, 776, 376},
+        {89, 777, 7926}, {89, 803, 7924}, {90, 769, 377}, {90, 770, 7824},
+        {90, 775, 379}, {90, 780, 381}, {90, 803, 7826}, {90, 817, 7828},
+        {97, 768, 224}, {97, 769, 225}, {97, 770, 226}, {97, 771, 227},
+        {97, 772, 257}, {97, 774, 259}, {97, 775, 551}, {97, 776, 228},
+        {97, 777, 7843}, {97, 778, 229}, {97, 780, 462}, {97, 783, 513},
+        {97, 785, 515}, {97, 803, 7841}, {97, 805, 7681}, {97, 808, 261},
+        {98, 775, 7683}, {98, 803, 7685}, {98, 817, 7687}, {99, 769, 263},
+        {99, 770, 265}, {99, 775, 267}, {99, 780, 269}, {99, 807, 231},
+        {100, 775, 7691}, {100, 780, 271}, {100, 803, 7693}, {100, 807, 7697},
+        {100, 813, 7699}, {100, 817, 7695}, {101, 768, 232}, {101, 769, 233},
+        {101, 770, 234}, {101, 771, 7869}, {101, 772, 275}, {101, 774, 277},
+        {101, 775, 279}, {101, 776, 235}, {101, 777, 7867}, {101, 780, 283},
+        {101, 783, 517}, {101, 785, 519}, {101, 803, 7865}, {101, 807, 553},
+        {101, 808, 281}, {101, 813, 7705}, {101, 816, 7707}, {102, 775, 7711},
+        {103, 769, 501}, {103, 770, 285}, {103, 772, 7713}, {103, 774, 287},
+        {103, 775, 289}, {103, 780, 487}, {103, 807, 291}, {104, 770, 293},
+        {104, 775, 7715}, {104, 776, 7719}, {104, 780, 543}, {104, 803, 7717},
+        {104, 807, 7721}, {104, 814, 7723}, {104, 817, 7830}, {105, 768, 236},
+        {105, 769, 237}, {105, 770, 238}, {105, 771, 297}, {105, 772, 299},
+        {105, 774, 301}, {105, 776, 239}, {105, 777, 7881}, {105, 780, 464},
+        {105, 783, 521}, {105, 785, 523}, {105, 803, 7883}, {105, 808, 303},
+        {105, 816, 7725}, {106, 770, 309}, {106, 780, 496}, {107, 769, 7729},
+        {107, 780, 489}, {107, 803, 7731}, {107, 807, 311}, {107, 817, 7733},
+        {108, 769, 314}, {108, 780, 318}, {108, 803, 7735}, {108, 807, 316},
+        {108, 813, 7741}, {108, 817, 7739}, {109, 769, 7743}, {109, 775, 7745},
+        {109, 803, 7747}, {110, 768, 505}, {110, 769, 324}, {110, 771, 241},
+        {110, 775, 7749}, {110, 780, 328}, {110, 803, 7751}, {110, 807, 326},
+        {110, 813, 7755}, {110, 817, 7753}, {111, 768, 242}, {111, 769, 243},
+        {111, 770, 244}, {111, 771, 245}, {111, 772, 333}, {111, 774, 335},
+        {111, 775, 559}, {111, 776, 246}, {111, 777, 7887}, {111, 779, 337},
+        {111, 780, 466}, {111, 783, 525}, {111, 785, 527}, {111, 795, 417},
+        {111, 803, 7885}, {111, 808, 491}, {112, 769, 7765}, {112, 775, 7767},
+        {114, 769, 341}, {114, 775, 7769}, {114, 780, 345}, {114, 783, 529},
+        {114, 785, 531}, {114, 803, 7771}, {114, 807, 343}, {114, 817, 7775},
+        {115, 769, 347}, {115, 770, 349}, {115, 775, 7777}, {115, 780, 353},
+        {115, 803, 7779}, {115, 806, 537}, {115, 807, 351}, {116, 775, 7787},
+        {116, 776, 7831}, {116, 780, 357}, {116, 803, 7789}, {116, 806, 539},
+        {116, 807, 355}, {116, 813, 7793}, {116, 817, 7791}, {117, 768, 249},
+        {117, 769, 250}, {117, 770, 251}, {117, 771, 361}, {117, 772, 363},
+        {117, 774, 365}, {117, 776, 252}, {117, 777, 7911}, {117, 778, 367},
+        {117, 779, 369}, {117, 780, 468}, {117, 783, 533}, {117, 785, 535},
+        {117, 795, 432}, {117, 803, 7909}, {117, 804, 7795}, {117, 808, 371},
+        {117, 813, 7799}, {117, 816, 7797}, {118, 771, 7805}, {118, 803, 7807},
+        {119, 768, 7809}, {119, 769, 7811}, {119, 770, 373}, {119, 775, 7815},
+        {119, 776, 7813}, {119, 778, 7832}, {119, 803, 7817}, {120, 775, 7819},
+        {120, 776, 7821}, {121, 768, 7923}, {121, 769, 253}, {121, 770, 375},
+        {121, 771, 7929}, {121, 772, 563}, {121, 775, 7823}, {121, 776, 255},
+        {121, 777, 7927}, {121, 778, 7833}, {121, 803, 7925}, {122, 769, 378},
+        {122, 770, 7825}, {122, 775, 380}, {122, 780, 382}, {122, 803, 7827},
+        {122, 817, 7829}, {168, 768, 8173}, {168, 769, 901}, {168, 834, 8129},
+        {194, 768, 7846}, {194, 769, 7844}, {194, 771, 7850}, {194, 777, 7848},
+        {196, 772, 478}, {197, 769, 506}, {198, 769, 508}, {198, 772, 482},
+        {199, 769, 7688}, {202, 768, 7872}, {202, 769, 7870}, {202, 771, 7876},
+        {202, 777, 7874}, {207, 769, 7726}, {212, 768, 7890}, {212, 769, 7888},
+        {212, 771, 7894}, {212, 777, 7892}, {213, 769, 7756}, {213, 772, 556},
+        {213, 776, 7758}, {214, 772, 554}, {216, 769, 510}, {220, 768, 475},
+        {220, 769, 471}, {220, 772, 469}, {220, 780, 473}, {226, 768, 7847},
+        {226, 769, 7845}, {226, 771, 7851}, {226, 777, 7849}, {228, 772, 479},
+        {229, 769, 507}, {230, 769, 509}, {230, 772, 483}, {231, 769, 7689},
+        {234, 768, 7873}, {234, 769, 7871}, {234, 771, 7877}, {234, 777, 7875},
+        {239, 769, 7727}, {244, 768, 7891}, {244, 769, 7889}, {244, 771, 7895},
+        {244, 777, 7893}, {245, 769, 7757}, {245, 772, 557}, {245, 776, 7759},
+        {246, 772, 555}, {248, 769, 511}, {252, 768, 476}, {252, 769, 472},
+        {252, 772, 470}, {252, 780, 474}, {258, 768, 7856}, {258, 769, 7854},
+        {258, 771, 7860}, {258, 777, 7858}, {259, 768, 7857}, {259, 769, 7855},
+        {259, 771, 7861}, {259, 777, 7859}, {274, 768, 7700}, {274, 769, 7702},
+        {275, 768, 7701}, {275, 769, 7703}, {332, 768, 7760}, {332, 769, 7762},
+        {333, 768, 7761}, {333, 769, 7763}, {346, 775, 7780}, {347, 775, 7781},
+        {352, 775, 7782}, {353, 775, 7783}, {360, 769, 7800}, {361, 769, 7801},
+        {362, 776, 7802}, {363, 776, 7803}, {383, 775, 7835}, {416, 768, 7900},
+        {416, 769, 7898}, {416, 771, 7904}, {416, 777, 7902}, {416, 803, 7906},
+        {417, 768, 7901}, {417, 769, 7899}, {417, 771, 7905}, {417, 777, 7903},
+        {417, 803, 7907}, {431, 768, 7914}, {431, 769, 7912}, {431, 771, 7918},
+        {431, 777, 7916}, {431, 803, 7920}, {432, 768, 7915}, {432, 769, 7913},
+        {432, 771, 7919}, {432, 777, 7917}, {432, 803, 7921}, {439, 780, 494},
+        {490, 772, 492}, {491, 772, 493}, {550, 772, 480}, {551, 772, 481},
+        {552, 774, 7708}, {553, 774, 7709}, {558, 772, 560}, {559, 772, 561},
+        {658, 780, 495}, {913, 768, 8122}, {913, 769, 902}, {913, 772, 8121},
+        {913, 774, 8120}, {913, 787, 7944}, {913, 788, 7945}, {913, 837, 8124},
+        {917, 768, 8136}, {917, 769, 904}, {917, 787, 7960}, {917, 788, 7961},
+        {919, 768, 8138}, {919, 769, 905}, {919, 787, 7976}, {919, 788, 7977},
+        {919, 837, 8140}, {921, 768, 8154}, {921, 769, 906}, {921, 772, 8153},
+        {921, 774, 8152}, {921, 776, 938}, {921, 787, 7992}, {921, 788, 7993},
+        {927, 768, 8184}, {927, 769, 908}, {927, 787, 8008}, {927, 788, 8009},
+        {929, 788, 8172}, {933, 768, 8170}, {933, 769, 910}, {933, 772, 8169},
+        {933, 774, 8168}, {933, 776, 939}, {933, 788, 8025}, {937, 768, 8186},
+        {937, 769, 911}, {937, 787, 8040}, {937, 788, 8041}, {937, 837, 8188},
+        {940, 837, 8116}, {942, 837, 8132}, {945, 768, 8048}, {945, 769, 940},
+        {945, 772, 8113}, {945, 774, 8112}, {945, 787, 7936}, {945, 788, 7937},
+        {945, 834, 8118}, {945, 837, 8115}, {949, 768, 8050}, {949, 769, 941},
+        {949, 787, 7952}, {949, 788, 7953}, {951, 768, 8052}, {951, 769, 942},
+        {951, 787, 7968}, {951, 788, 7969}, {951, 834, 8134}, {951, 837, 8131},
+        {953, 768, 8054}, {953, 769, 943}, {953, 772, 8145}, {953, 774, 8144},
+        {953, 776, 970}, {953, 787, 7984}, {953, 788, 7985}, {953, 834, 8150},
+        {959, 768, 8056}, {959, 769, 972}, {959, 787, 8000}, {959, 788, 8001},
+        {961, 787, 8164}, {961, 788, 8165}, {965, 768, 8058}, {965, 769, 973},
+        {965, 772, 8161}, {965, 774, 8160}, {965, 776, 971}, {965, 787, 8016},
+        {965, 788, 8017}, {965, 834, 8166}, {969, 768, 8060}, {969, 769, 974},
+        {969, 787, 8032}, {969, 788, 8033}, {969, 834, 8182}, {969, 837, 8179},
+        {970, 768, 8146}, {970, 769, 912}, {970, 834, 8151}, {971, 768, 8162},
+        {971, 769, 944}, {971, 834, 8167}, {974, 837, 8180}, {978, 769, 979},
+        {978, 776, 980}, {1030, 776, 1031}, {1040, 774, 1232}, {1040, 776, 1234},
+        {1043, 769, 1027}, {1045, 768, 1024}, {1045, 774, 1238}, {1045, 776, 1025},
+        {1046, 774, 1217}, {1046, 776, 1244}, {1047, 776, 1246}, {1048, 768, 1037},
+        {1048, 772, 1250}, {1048, 774, 1049}, {1048, 776, 1252}, {1050, 769, 1036},
+        {1054, 776, 1254}, {1059, 772, 1262}, {1059, 774, 1038}, {1059, 776, 1264},
+        {1059, 779, 1266}, {1063, 776, 1268}, {1067, 776, 1272}, {1069, 776, 1260},
+        {1072, 774, 1233}, {1072, 776, 1235}, {1075, 769, 1107}, {1077, 768, 1104},
+        {1077, 774, 1239}, {1077, 776, 1105}, {1078, 774, 1218}, {1078, 776, 1245},
+        {1079, 776, 1247}, {1080, 768, 1117}, {1080, 772, 1251}, {1080, 774, 1081},
+        {1080, 776, 1253}, {1082, 769, 1116}, {1086, 776, 1255}, {1091, 772, 1263},
+        {1091, 774, 1118}, {1091, 776, 1265}, {1091, 779, 1267}, {1095, 776, 1269},
+        {1099, 776, 1273}, {1101, 776, 1261}, {1110, 776, 1111}, {1140, 783, 1142},
+        {1141, 783, 1143}, {1240, 776, 1242}, {1241, 776, 1243}, {1256, 776, 1258},
+        {1257, 776, 1259}, {1575, 1619, 1570}, {1575, 1620, 1571}, {1575, 1621, 1573},
+        {1608, 1620, 1572}, {1610, 1620, 1574}, {1729, 1620, 1730}, {1746, 1620, 1747},
+        {1749, 1620, 1728}, {2344, 2364, 2345}, {2352, 2364, 2353}, {2355, 2364, 2356},
+        {2503, 2494, 2507}, {2503, 2519, 2508}, {2887, 2878, 2891}, {2887, 2902, 2888},
+        {2887, 2903, 2892}, {2962, 3031, 2964}, {3014, 3006, 3018}, {3014, 3031, 3020},
+        {3015, 3006, 3019}, {3142, 3158, 3144}, {3263, 3285, 3264}, {3270, 3266, 3274},
+        {3270, 3285, 3271}, {3270, 3286, 3272}, {3274, 3285, 3275}, {3398, 3390, 3402},
+        {3398, 3415, 3404}, {3399, 3390, 3403}, {3545, 3530, 3546}, {3545, 3535, 3548},
+        {3545, 3551, 3550}, {3548, 3530, 3549}, {4133, 4142, 4134}, {6917, 6965, 6918},
+        {6919, 6965, 6920}, {6921, 6965, 6922}, {6923, 6965, 6924}, {6925, 6965, 6926},
+        {6929, 6965, 6930}, {6970, 6965, 6971}, {6972, 6965, 6973}, {6974, 6965, 6976},
+        {6975, 6965, 6977}, {6978, 6965, 6979}, {7734, 772, 7736}, {7735, 772, 7737},
+        {7770, 772, 7772}, {7771, 772, 7773}, {7778, 775, 7784}, {7779, 775, 7785},
+        {7840, 770, 7852}, {7840, 774, 7862}, {7841, 770, 7853}, {7841, 774, 7863},
+        {7864, 770, 7878}, {7865, 770, 7879}, {7884, 770, 7896}, {7885, 770, 7897},
+        {7936, 768, 7938}, {7936, 769, 7940}, {7936, 834, 7942}, {7936, 837, 8064},
+        {7937, 768, 7939}, {7937, 769, 7941}, {7937, 834, 7943}, {7937, 837, 8065},
+        {7938, 837, 8066}, {7939, 837, 8067}, {7940, 837, 8068}, {7941, 837, 8069},
+        {7942, 837, 8070}, {7943, 837, 8071}, {7944, 768, 7946}, {7944, 769, 7948},
+        {7944, 834, 7950}, {7944, 837, 8072}, {7945, 768, 7947}, {7945, 769, 7949},
+        {7945, 834, 7951}, {7945, 837, 8073}, {7946, 837, 8074}, {7947, 837, 8075},
+        {7948, 837, 8076}, {7949, 837, 8077}, {7950, 837, 8078}, {7951, 837, 8079},
+        {7952, 768, 7954}, {7952, 769, 7956}, {7953, 768, 7955}, {7953, 769, 7957},
+        {7960, 768, 7962}, {7960, 769, 7964}, {7961, 768, 7963}, {7961, 769, 7965},
+        {7968, 768, 7970}, {7968, 769, 7972}, {7968, 834, 7974}, {7968, 837, 8080},
+        {7969, 768, 7971}, {7969, 769, 7973}, {7969, 834, 7975}, {7969, 837, 8081},
+        {7970, 837, 8082}, {7971, 837, 8083}, {7972, 837, 8084}, {7973, 837, 8085},
+        {7974, 837, 8086}, {7975, 837, 8087}, {7976, 768, 7978}, {7976, 769, 7980},
+        {7976, 834, 7982}, {7976, 837, 8088}, {7977, 768, 7979}, {7977, 769, 7981},
+        {7977, 834, 7983}, {7977, 837, 8089}, {7978, 837, 8090}, {7979, 837, 8091},
+        {7980, 837, 8092}, {7981, 837, 8093}, {7982, 837, 8094}, {7983, 837, 8095},
+        {7984, 768, 7986}, {7984, 769, 7988}, {7984, 834, 7990}, {7985, 768, 7987},
+        {7985, 769, 7989}, {7985, 834, 7991}, {7992, 768, 7994}, {7992, 769, 7996},
+        {7992, 834, 7998}, {7993, 768, 7995}, {7993, 769, 7997}, {7993, 834, 7999},
+        {8000, 768, 8002}, {8000, 769, 8004}, {8001, 768, 8003}, {8001, 769, 8005},
+        {8008, 768, 8010}, {8008, 769, 8012}, {8009, 768, 8011}, {8009, 769, 8013},
+        {8016, 768, 8018}, {8016, 769, 8020}, {8016, 834, 8022}, {8017, 768, 8019},
+        {8017, 769, 8021}, {8017, 834, 8023}, {8025, 768, 8027}, {8025, 769, 8029},
+        {8025, 834, 8031}, {8032, 768, 8034}, {8032, 769, 8036}, {8032, 834, 8038},
+        {8032, 837, 8096}, {8033, 768, 8035}, {8033, 769, 8037}, {8033, 834, 8039},
+        {8033, 837, 8097}, {8034, 837, 8098}, {8035, 837, 8099}, {8036, 837, 8100},
+        {8037, 837, 8101}, {8038, 837, 8102}, {8039, 837, 8103}, {8040, 768, 8042},
+        {8040, 769, 8044}, {8040, 834, 8046}, {8040, 837, 8104}, {8041, 768, 8043},
+        {8041, 769, 8045}, {8041, 834, 8047}, {8041, 837, 8105}, {8042, 837, 8106},
+        {8043, 837, 8107}, {8044, 837, 8108}, {8045, 837, 8109}, {8046, 837, 8110},
+        {8047, 837, 8111}, {8048, 837, 8114}, {8052, 837, 8130}, {8060, 837, 8178},
+        {8118, 837, 8119}, {8127, 768, 8141}, {8127, 769, 8142}, {8127, 834, 8143},
+        {8134, 837, 8135}, {8182, 837, 8183}, {8190, 768, 8157}, {8190, 769, 8158},
+        {8190, 834, 8159}, {8592, 824, 8602}, {8594, 824, 8603}, {8596, 824, 8622},
+        {8656, 824, 8653}, {8658, 824, 8655}, {8660, 824, 8654}, {8707, 824, 8708},
+        {8712, 824, 8713}, {8715, 824, 8716}, {8739, 824, 8740}, {8741, 824, 8742},
+        {8764, 824, 8769}, {8771, 824, 8772}, {8773, 824, 8775}, {8776, 824, 8777},
+        {8781, 824, 8813}, {8801, 824, 8802}, {8804, 824, 8816}, {8805, 824, 8817},
+        {8818, 824, 8820}, {8819, 824, 8821}, {8822, 824, 8824}, {8823, 824, 8825},
+        {8826, 824, 8832}, {8827, 824, 8833}, {8828, 824, 8928}, {8829, 824, 8929},
+        {8834, 824, 8836}, {8835, 824, 8837}, {8838, 824, 8840}, {8839, 824, 8841},
+        {8849, 824, 8930}, {8850, 824, 8931}, {8866, 824, 8876}, {8872, 824, 8877},
+        {8873, 824, 8878}, {8875, 824, 8879}, {8882, 824, 8938}, {8883, 824, 8939},
+        {8884, 824, 8940}, {8885, 824, 8941}, {12358, 12441, 12436}, {12363, 12441, 12364},
+        {12365, 12441, 12366}, {12367, 12441, 12368}, {12369, 12441, 12370}, {12371, 12441, 12372},
+        {12373, 12441, 12374}, {12375, 12441, 12376}, {12377, 12441, 12378}, {12379, 12441, 12380},
+        {12381, 12441, 12382}, {12383, 12441, 12384}, {12385, 12441, 12386}, {12388, 12441, 12389},
+        {12390, 12441, 12391}, {12392, 12441, 12393}, {12399, 12441, 12400}, {12399, 12442, 12401},
+        {12402, 12441, 12403}, {12402, 12442, 12404}, {12405, 12441, 12406}, {12405, 12442, 12407},
+        {12408, 12441, 12409}, {12408, 12442, 12410}, {12411, 12441, 12412}, {12411, 12442, 12413},
+        {12445, 12441, 12446}, {12454, 12441, 12532}, {12459, 12441, 12460}, {12461, 12441, 12462},
+        {12463, 12441, 12464}, {12465, 12441, 12466}, {12467, 12441, 12468}, {12469, 12441, 12470},
+        {12471, 12441, 12472}, {12473, 12441, 12474}, {12475, 12441, 12476}, {12477, 12441, 12478},
+        {12479, 12441, 12480}, {12481, 12441, 12482}, {12484, 12441, 12485}, {12486, 12441, 12487},
+        {12488, 12441, 12489}, {12495, 12441, 12496}, {12495, 12442, 12497}, {12498, 12441, 12499},
+        {12498, 12442, 12500}, {12501, 12441, 12502}, {12501, 12442, 12503}, {12504, 12441, 12505},
+        {12504, 12442, 12506}, {12507, 12441, 12508}, {12507, 12442, 12509}, {12527, 12441, 12535},
+        {12528, 12441, 12536}, {12529, 12441, 12537}, {12530, 12441, 12538}, {12541, 12441, 12542},
+        {69785, 69818, 69786}, {69787, 69818, 69788}, {69797, 69818, 69803}, {69937, 69927, 69934},
+        {69938, 69927, 69935}, {70471, 70462, 70475}, {70471, 70487, 70476}, {70841, 70832, 70844},
+        {70841, 70842, 70843}, {70841, 70845, 70846}, {71096, 71087, 71098}, {71097, 71087, 71099},
+        {71989, 71984, 71992},
+};
+
+#endif /* UTF8C_NORM_TABLES_H*/
@@ -0,0 +1,553 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Canonical normalization forms NFC and NFD (UAX #15) and full case folding. Stretches of text a form leaves
+ * as they are are found with a vector scan and quick check properties and copied in bulk, only the code points
+ * around the rest are decomposed, reordered and composed*/
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_into.h"
+#include "utf8c_norm_tables.h"
+#include "utf8c_stats.h"
+
+/* Record flags above the combining class, see tools/gen_norm_tables.py*/
+#define NORM_CCC        0xFF
+#define NORM_NFD_NO     0x100   /* Has a canonical decomposition*/
+#define NORM_NFC_NO     0x200   /* Never appears in NFC*/
+#define NORM_NFC_MAYBE  0x400   /* May compose with the code point before it*/
+#define NORM_FOLDS      0x800   /* Changes when case folded*/
+
+#define FORM_NFC  0
+#define FORM_NFD  1
+#define FORM_FOLD 2
+
+/* Octets below this one only make up code points below U+0300, which are all NFC starters*/
+#define NFC_SAFE_LIMIT 0xCC
+
+/* Number of code points reordered and composed at once. Longer runs of combining marks are outside
+ * the Stream-Safe Text Format of UAX #15 and get processed in pieces of this size*/
+#define SEGMENT_MAX 32
+
+/* Hangul syllables are decomposed and composed by the algorithm of chapter 3.12 of the standard*/
+#define HANGUL_S_BASE  0xAC00
+#define HANGUL_L_BASE  0x1100
+#define HANGUL_V_BASE  0x1161
+#define HANGUL_T_BASE  0x11A7
+#define HANGUL_L_COUNT 19
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+#define N_COMPOSE (sizeof(utf8c_norm_compose) / sizeof(utf8c_norm_compose[0]))
+
+/* Error value of a sink that compares the output with its input, nothing is written then*/
+#define SINK_DIFFERS (-1)
+
+/* Where the output goes: a caller buffer, a builder or nowhere, when it's only compared with the input*/
+typedef struct norm_sink {
+    utf8c_into *into;
+    utf8_builder *builder;
+    const char *cmp;        /* Input to compare with if both `into` and `builder` are NULL*/
+    size_t cmp_len;
+    size_t total;           /* Number of octets of output so far*/
+    int error;              /* UTF8_OK, UTF8_ENOMEM, UTF8_ERANGE or SINK_DIFFERS*/
+} norm_sink;
+
+/* Code points waiting to be reordered and composed: a starter, if there is one, and combining marks after it*/
+typedef struct norm_segment {
+    utf8_char32 cps[SEGMENT_MAX];
+    unsigned char ccc[SEGMENT_MAX];
+    size_t n;
+} norm_segment;
+
+static const unsigned short *norm_record(utf8_char32 cp) {
+    return utf8c_norm_records[utf8c_norm_stage2[((size_t) utf8c_norm_stage1[cp >> UTF8C_NORM_SHIFT]
+                                                 << UTF8C_NORM_SHIFT) + (cp & UTF8C_NORM_MASK)]];
+}
+
+/* `s`      - pointer to an octet before `end`
+ * `cp`     - pointer to a variable that receives the decoded code point
+ * return   - number of octets decoded or 0 if `s` doesn't start a well-formed sequence*/
+static size_t decode(const unsigned char *s, const unsigned char *end, utf8_char32 *cp) {
+    utf8_char32 c;
+    size_t n, k;
+
+    c = s[0];
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    }
+    if (c < 0xC2 || c >= 0xF5) {
+        return 0;
+    }
+    n = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : 2;
+    if ((size_t) (end - s) < n) {
+        return 0;
+    }
+
+    c &= 0x3F >> (n - 1);
+    for (k = 1; k < n; k++) {
+        if (!UTF8C_IS_CONT(s[k])) {
+            return 0;
+        }
+        c = (c << 6) | (s[k] & 0x3F);
+    }
+    /* Overlong, surrogate or out of range*/
+    if ((n == 3 && (c < 0x800 || (c >= 0xD800 && c <= 0xDFFF))) || (n == 4 && (c < 0x10000 || c > 0x10FFFF))) {
+        return 0;
+    }
+    *cp = c;
+    return n;
+}
+
+/* return   - flags of code points `form` may change or that may change something before them. Code points
+ *     with none of them are stable: left as they are, and work on the text before them can stop there*/
+static unsigned int unstable_flags(int form) {
+    switch (form) {
+        case FORM_NFC:
+            return NORM_CCC | NORM_NFC_NO | NORM_NFC_MAYBE;
+        case FORM_NFD:
+            return NORM_CCC | NORM_NFD_NO;
+        default:
+            return NORM_FOLDS;
+    }
+}
+
+/* return   - number of octets at the beginning of `s` that are stable for `form`, found with a vector scan*/
+static size_t skip_stable(int form, const char *s, size_t len) {
+    switch (form) {
+        case FORM_NFC:
+            return utf8c_skip_below(s, len, NFC_SAFE_LIMIT);
+        case FORM_NFD:
+            return utf8c_skip_ascii(s, len);
+        default:
+            return utf8c_skip_folded_ascii(s, len);
+    }
+}
+
+static void emit(norm_sink *sink, const char *s, size_t n) {
+    if (sink->error != UTF8_OK || n == 0) {
+        return;
+    }
+    if (n > (size_t) -1 - 1 - sink->total) {
+        sink->error = UTF8_ERANGE;
+        return;
+    }
+
+    if (sink->into != NULL) {
+        utf8c_into_put(sink->into, s, n);
+    } else if (sink->builder != NULL) {
+        sink->error = utf8_builder_append(sink->builder, s, n);
+    } else if (n > sink->cmp_len - sink->total
+               || (s != sink->cmp + sink->total && memcmp(s, sink->cmp + sink->total, sizeof(char) * n) != 0)) {
+        sink->error = SINK_DIFFERS;
+    }
+    sink->total += n;
+}
+
+/* return   - composite of `a` followed by `b` or 0 if there's none*/
+static utf8_char32 compose(utf8_char32 a, utf8_char32 b) {
+    size_t lo, hi, mid;
+
+    if (a >= HANGUL_L_BASE && a < HANGUL_L_BASE + HANGUL_L_COUNT
+        && b >= HANGUL_V_BASE && b < HANGUL_V_BASE + HANGUL_V_COUNT) {
+        return HANGUL_S_BASE + ((a - HANGUL_L_BASE) * HANGUL_V_COUNT + (b - HANGUL_V_BASE)) * HANGUL_T_COUNT;
+    }
+    if (a >= HANGUL_S_BASE && a < HANGUL_S_BASE + HANGUL_S_COUNT && (a - HANGUL_S_BASE) % HANGUL_T_COUNT == 0
+        && b > HANGUL_T_BASE && b < HANGUL_T_BASE + HANGUL_T_COUNT) {
+        return a + (b - HANGUL_T_BASE);
+    }
+    if ((norm_record(b)[0] & NORM_NFC_MAYBE) == 0) {
+        return 0;
+    }
+
+    lo = 0;
+    hi = N_COMPOSE;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (utf8c_norm_compose[mid][0] < a || (utf8c_norm_compose[mid][0] == a && utf8c_norm_compose[mid][1] < b)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == N_COMPOSE || utf8c_norm_compose[lo][0] != a || utf8c_norm_compose[lo][1] != b) {
+        return 0;
+    }
+    return utf8c_norm_compose[lo][2];
+}
+
+/* Puts combining marks into canonical order and, for NFC, composes them with the starter*/
+static void segment_finish(norm_segment *seg, int form) {
+    size_t k, m, out;
+    utf8_char32 cp, composite;
+    unsigned char ccc, last_ccc;
+
+    /* Insertion sort is stable and segments are short*/
+    for (k = 1; k < seg->n; k++) {
+        cp = seg->cps[k];
+        ccc = seg->ccc[k];
+        for (m = k; m > 0 && seg->ccc[m - 1] > ccc; m--) {
+            seg->cps[m] = seg->cps[m - 1];
+            seg->ccc[m] = seg->ccc[m - 1];
+        }
+        seg->cps[m] = cp;
+        seg->ccc[m] = ccc;
+    }
+
+    if (form != FORM_NFC || seg->n == 0 || seg->ccc[0] != 0) {
+        return;
+    }
+    /* Marks are sorted, so a mark is only blocked from the starter by a kept one of the same class*/
+    last_ccc = 0;
+    for (k = 1, out = 1; k < seg->n; k++) {
+        if ((out == 1 || last_ccc < seg->ccc[k]) && (composite = compose(seg->cps[0], seg->cps[k])) != 0) {
+            seg->cps[0] = composite;
+            continue;
+        }
+        last_ccc = seg->ccc[k];
+        seg->cps[out] = seg->cps[k];
+        seg->ccc[out] = seg->ccc[k];
+        out++;
+    }
+    seg->n = out;
+}
+
+static void segment_emit(norm_segment *seg, norm_sink *sink) {
+    char buf[SEGMENT_MAX * UTF8C_CP_MAX];
+    size_t k, n;
+
+    for (k = 0, n = 0; k < seg->n; k++) {
+        n += utf8c_encode(seg->cps[k], buf + n);
+    }
+    emit(sink, buf, n);
+    seg->n = 0;
+}
+
+/* Adds a code point of a full decomposition to the segment, starters finish the segment before them*/
+static void segment_add(norm_segment *seg, norm_sink *sink, int form, utf8_char32 cp) {
+    utf8_char32 composite;
+    unsigned char ccc;
+
+    ccc = (unsigned char) (norm_record(cp)[0] & NORM_CCC);
+    if (ccc == 0 && seg->n != 0) {
+        segment_finish(seg, form);
+        /* A starter composes with the one before it only if nothing is left between them*/
+        if (form == FORM_NFC && seg->n == 1 && seg->ccc[0] == 0 && (composite = compose(seg->cps[0], cp)) != 0) {
+            seg->cps[0] = composite;
+            return;
+        }
+        segment_emit(seg, sink);
+    } else if (seg->n == SEGMENT_MAX) {
+        segment_finish(seg, form);
+        segment_emit(seg, sink);
+    }
+    seg->cps[seg->n] = cp;
+    seg->ccc[seg->n] = ccc;
+    seg->n++;
+}
+
+/* Normalizes [s, s + len) that doesn't depend on anything around it*/
+static void normalize_chunk(norm_sink *sink, const unsigned char *s, size_t len, int form) {
+    const unsigned char *end;
+    const unsigned short *rec;
+    const utf8_char32 *seq;
+    norm_segment seg;
+    utf8_char32 cp, sindex;
+    char buf[UTF8C_CP_MAX];
+    size_t n, k;
+
+    end = s + len;
+    seg.n = 0;
+    while (s != end) {
+        n = decode(s, end, &cp);
+        if (n == 0) { /* Ill-formed octets are copied as they are and nothing composes with them*/
+            segment_finish(&seg, form);
+            segment_emit(&seg, sink);
+            emit(sink, (const char *) s, 1);
+            s++;
+            continue;
+        }
+
+        rec = norm_record(cp);
+        if (form == FORM_FOLD) {
+            if (cp >= 'A' && cp <= 'Z') {
+                buf[0] = (char) (cp + ('a' - 'A'));
+                emit(sink, buf, 1);
+            } else if (rec[2] == 0) {
+                emit(sink, (const char *) s, n);
+            } else {
+                seq = &utf8c_norm_data[rec[2]];
+                for (k = 1; k <= seq[0]; k++) {
+                    emit(sink, buf, utf8c_encode(seq[k], buf));
+                }
+            }
+        } else if (cp >= HANGUL_S_BASE && cp < HANGUL_S_BASE + HANGUL_S_COUNT) {
+            sindex = cp - HANGUL_S_BASE;
+            segment_add(&seg, sink, form, HANGUL_L_BASE + sindex / HANGUL_N_COUNT);
+            segment_add(&seg, sink, form, HANGUL_V_BASE + (sindex % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+            if (sindex % HANGUL_T_COUNT != 0) {
+                segment_add(&seg, sink, form, HANGUL_T_BASE + sindex % HANGUL_T_COUNT);
+            }
+        } else if (rec[1] != 0) {
+            seq = &utf8c_norm_data[rec[1]];
+            for (k = 1; k <= seq[0]; k++) {
+                segment_add(&seg, sink, form, seq[k]);
+            }
+        } else {
+            segment_add(&seg, sink, form, cp);
+        }
+        s += n;
+    }
+    segment_finish(&seg, form);
+    segment_emit(&seg, sink);
+}
+
+static void normalize(norm_sink *sink, const char *str, size_t len, int form) {
+    const unsigned char *s;
+    size_t i, j, last, n;
+    unsigned int unstable;
+    utf8_char32 cp;
+
+    s = (const unsigned char *) str;
+    unstable = unstable_flags(form);
+    i = 0;
+    while (i < len && sink->error == UTF8_OK) {
+        /* [i, j) is left as it is, `last` is the beginning of its last code point*/
+        j = i + skip_stable(form, str + i, len - i);
+        last = j;
+        if (j > i) {
+            last = j - 1;
+            while (last > i && UTF8C_IS_CONT(s[last])) {
+                last--;
+            }
+        }
+        n = 0;
+        while (j < len) {
+            n = decode(s + j, s + len, &cp);
+            if (n == 0) {
+                n = 1;
+            } else if ((norm_record(cp)[0] & unstable) != 0) {
+                break;
+            }
+            last = j;
+            j += n;
+        }
+        if (j == len) {
+            UTF8C_STAT_ADD(fast, i == 0);
+            emit(sink, str + i, len - i);
+            break;
+        }
+
+        /* The code point at `j` changes and, for NFC, may compose with the one before it. Work goes on up to
+         * the next stable code point, which nothing after it changes*/
+        if (form == FORM_NFC && j > i) {
+            emit(sink, str + i, last - i);
+            i = last;
+        } else {
+            emit(sink, str + i, j - i);
+            i = j;
+        }
+        for (j += n; j < len; j += n) {
+            n = decode(s + j, s + len, &cp);
+            if (n == 0 || (norm_record(cp)[0] & unstable) == 0) {
+                break;
+            }
+        }
+        UTF8C_STAT_ADD(slow, 1);
+        normalize_chunk(sink, s + i, j - i, form);
+        i = j;
+    }
+}
+
+/* return   - whether `form` leaves [str, str + len) as it is*/
+static int is_normalized(const char *str, size_t len, int form) {
+    norm_sink sink;
+
+    if (str == NULL) {
+        errno = UTF8_EINVAL;
+        return 0;
+    }
+
+    memset(&sink, 0, sizeof(sink));
+    sink.cmp = str;
+    sink.cmp_len = len;
+    normalize(&sink, str, len, form);
+    return sink.error == UTF8_OK && sink.total == len;
+}
+
+static size_t normalize_into(char *dst, size_t dst_cap, const char *str, size_t len, int form) {
+    utf8c_into out;
+    norm_sink sink;
+
+    if (str == NULL || (dst == NULL && dst_cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    utf8c_into_begin(&out, dst, dst_cap);
+    memset(&sink, 0, sizeof(sink));
+    sink.into = &out;
+    normalize(&sink, str, len, form);
+    if (sink.error != UTF8_OK) {
+        errno = sink.error;
+        return utf8_npos;
+    }
+    return utf8c_into_end(&out, dst_cap, sink.total);
+}
+
+static int builder_append(utf8_builder *builder, const char *str, size_t len, int form) {
+    norm_sink sink;
+    size_t old_len, old_n_cps;
+
+    if (builder == NULL || str == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    old_len = builder->len;
+    old_n_cps = builder->n_cps;
+    memset(&sink, 0, sizeof(sink));
+    sink.builder = builder;
+    normalize(&sink, str, len, form);
+    if (sink.error != UTF8_OK) { /* Leave the builder as it was*/
+        builder->len = old_len;
+        builder->n_cps = old_n_cps;
+        if (builder->data != NULL) {
+            builder->data[old_len] = '\0';
+        }
+        errno = sink.error;
+        return sink.error;
+    }
+    return UTF8_OK;
+}
+
+static char *normalize_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len, int form) {
+    utf8_builder builder;
+
+    if (str == NULL) {
+        errno = UTF8_EINVAL;
+        return NULL;
+    }
+
+    utf8_builder_init(&builder, alloc);
+    if (utf8_builder_reserve(&builder, len) != UTF8_OK || builder_append(&builder, str, len, form) != UTF8_OK) {
+        utf8_builder_free(&builder);
+        return NULL;
+    }
+    return utf8_builder_finish(&builder, out_len);
+}
+
+int utf8_is_nfc(const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_is_nfc, len);
+    return is_normalized(str, len, FORM_NFC);
+}
+
+int utf8_is_nfd(const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_is_nfd, len);
+    return is_normalized(str, len, FORM_NFD);
+}
+
+int utf8_is_casefolded(const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_is_casefolded, len);
+    return is_normalized(str, len, FORM_FOLD);
+}
+
+char *utf8_normalize_nfc(const char *str) {
+    UTF8C_STAT_CALL(utf8_normalize_nfc, 0);
+    return normalize_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, NULL, FORM_NFC);
+}
+
+char *utf8_normalize_nfc_n(const char *str, size_t len, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_normalize_nfc_n, len);
+    return normalize_a(NULL, str, len, out_len, FORM_NFC);
+}
+
+char *utf8_normalize_nfc_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_normalize_nfc_a, len);
+    return normalize_a(alloc, str, len, out_len, FORM_NFC);
+}
+
+size_t utf8_normalize_nfc_into(char *dst, size_t dst_cap, const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_normalize_nfc_into, len);
+    return normalize_into(dst, dst_cap, str, len, FORM_NFC);
+}
+
+int utf8_builder_append_nfc(utf8_builder *builder, const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_builder_append_nfc, len);
+    return builder_append(builder, str, len, FORM_NFC);
+}
+
+char *utf8_normalize_nfd(const char *str) {
+    UTF8C_STAT_CALL(utf8_normalize_nfd, 0);
+    return normalize_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, NULL, FORM_NFD);
+}
+
+char *utf8_normalize_nfd_n(const char *str, size_t len, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_normalize_nfd_n, len);
+    return normalize_a(NULL, str, len, out_len, FORM_NFD);
+}
+
+char *utf8_normalize_nfd_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_normalize_nfd_a, len);
+    return normalize_a(alloc, str, len, out_len, FORM_NFD);
+}
+
+size_t utf8_normalize_nfd_into(char *dst, size_t dst_cap, const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_normalize_nfd_into, len);
+    return normalize_into(dst, dst_cap, str, len, FORM_NFD);
+}
+
+int utf8_builder_append_nfd(utf8_builder *builder, const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_builder_append_nfd, len);
+    return builder_append(builder, str, len, FORM_NFD);
+}
+
+char *utf8_casefold(const char *str) {
+    UTF8C_STAT_CALL(utf8_casefold, 0);
+    return normalize_a(NULL, str, (str != NULL) ? utf8c_strlen(str) : 0, NULL, FORM_FOLD);
+}
+
+char *utf8_casefold_n(const char *str, size_t len, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_casefold_n, len);
+    return normalize_a(NULL, str, len, out_len, FORM_FOLD);
+}
+
+char *utf8_casefold_a(const utf8_allocator *alloc, const char *str, size_t len, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_casefold_a, len);
+    return normalize_a(alloc, str, len, out_len, FORM_FOLD);
+}
+
+size_t utf8_casefold_into(char *dst, size_t dst_cap, const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_casefold_into, len);
+    return normalize_into(dst, dst_cap, str, len, FORM_FOLD);
+}
+
+int utf8_builder_append_casefold(utf8_builder *builder, const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_builder_append_casefold, len);
+    return builder_append(builder, str, len, FORM_FOLD);
+}
@@ -0,0 +1,502 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Multi-threaded variants of counting, validation and transcoding. Input is split into one chunk per thread,
+ * chunk boundaries are moved to code point boundaries and the per chunk results are merged in chunk order,
+ * so the result is the same as the one of the single-threaded function whatever the executor does*/
+#if defined(UTF8C_THREADS) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_stats.h"
+
+#if defined(UTF8C_THREADS)
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* Smallest chunk worth a task of its own, in octets of input*/
+#define MIN_CHUNK   ((size_t) 1 << 20)
+#define MAX_TASKS   64
+
+#define IS_HIGH_SURROGATE(u) ((u) >= 0xD800 && (u) <= 0xDBFF)
+#define IS_LOW_SURROGATE(u)  ((u) >= 0xDC00 && (u) <= 0xDFFF)
+
+#if defined(UTF8C_THREADS)
+/* Pool of detached threads that live as long as the process. Runs one batch of tasks at a time,
+ * the calling thread takes tasks too*/
+typedef struct pool {
+    pthread_mutex_t busy;   /* held by the thread whose batch is running*/
+    pthread_mutex_t lock;   /* guards the fields below*/
+    pthread_cond_t work;
+    pthread_cond_t done;
+    void (*task)(void *arg, size_t i);
+    void *arg;
+    size_t n;
+    size_t next;
+    size_t finished;
+} pool;
+
+static pool the_pool = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+                        PTHREAD_COND_INITIALIZER, NULL, NULL, 0, 0, 0};
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+
+/* Takes and runs tasks of the current batch until none is left, `lock` is held on entry and on return*/
+static void pool_drain(pool *p) {
+    void (*task)(void *arg, size_t i);
+    void *arg;
+    size_t i;
+
+    while (p->next < p->n) {
+        i = p->next++;
+        task = p->task;
+        arg = p->arg;
+        pthread_mutex_unlock(&p->lock);
+        task(arg, i);
+        pthread_mutex_lock(&p->lock);
+        if (++p->finished == p->n) {
+            pthread_cond_signal(&p->done);
+        }
+    }
+}
+
+static void *pool_worker(void *arg) {
+    pool *p;
+
+    p = (pool *) arg;
+    pthread_mutex_lock(&p->lock);
+    for (;;) {
+        while (p->next >= p->n) {
+            pthread_cond_wait(&p->work, &p->lock);
+        }
+        pool_drain(p);
+    }
+    return NULL;
+}
+
+static void pool_run(void *ctx, void (*task)(void *arg, size_t i), void *arg, size_t n) {
+    pool *p;
+    size_t i;
+
+    p = (pool *) ctx;
+    /* Another thread's batch is running: its workers are taken, so running inline loses nothing*/
+    if (pthread_mutex_trylock(&p->busy) != 0) {
+        for (i = 0; i < n; i++) {
+            task(arg, i);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&p->lock);
+    p->task = task;
+    p->arg = arg;
+    p->n = n;
+    p->next = 0;
+    p->finished = 0;
+    pthread_cond_broadcast(&p->work);
+    pool_drain(p);
+    while (p->finished < p->n) {
+        pthread_cond_wait(&p->done, &p->lock);
+    }
+    p->n = 0;
+    p->next = 0;
+    pthread_mutex_unlock(&p->lock);
+    pthread_mutex_unlock(&p->busy);
+}
+
+static utf8_executor default_executor = {pool_run, &the_pool, 1};
+
+static void pool_start(void) {
+    pthread_attr_t attr;
+    pthread_t thread;
+    const char *env;
+    long n_threads;
+    long i;
+
+    env = getenv("UTF8C_THREADS");
+    n_threads = (env != NULL) ? strtol(env, NULL, 10) : sysconf(_SC_NPROCESSORS_ONLN);
+    if (n_threads < 1) {
+        n_threads = 1;
+    } else if (n_threads > MAX_TASKS) {
+        n_threads = MAX_TASKS;
+    }
+
+    if (pthread_attr_init(&attr) != 0) {
+        return;
+    }
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    /* The calling thread is one of the threads*/
+    for (i = 1; i < n_threads; i++) {
+        if (pthread_create(&thread, &attr, pool_worker, &the_pool) != 0) {
+            break;
+        }
+    }
+    pthread_attr_destroy(&attr);
+    default_executor.n_threads = (size_t) i;
+}
+
+const utf8_executor *utf8_default_executor(void) {
+    UTF8C_STAT_CALL(utf8_default_executor, 0);
+    pthread_once(&pool_once, pool_start);
+    return &default_executor;
+}
+#else
+static void serial_run(void *ctx, void (*task)(void *arg, size_t i), void *arg, size_t n) {
+    size_t i;
+
+    (void) ctx;
+    for (i = 0; i < n; i++) {
+        task(arg, i);
+    }
+}
+
+static const utf8_executor default_executor = {serial_run, NULL, 1};
+
+const utf8_executor *utf8_default_executor(void) {
+    UTF8C_STAT_CALL(utf8_default_executor, 0);
+    return &default_executor;
+}
+#endif
+
+enum {
+    JOB_DISTANCE, JOB_VALIDATE, JOB_TO_UTF32, JOB_TO_UTF16, JOB_FROM_UTF32, JOB_FROM_UTF16
+};
+
+typedef struct mt_job {
+    int kind;
+    const void *src;
+    void *dst;
+    size_t n_tasks;
+    size_t bounds[MAX_TASKS + 1];   /* chunk `i` is [bounds[i], bounds[i + 1]) in units of `src`*/
+    size_t counts[MAX_TASKS];       /* result of the first pass: code points, valid prefix or output length*/
+    size_t offsets[MAX_TASKS];      /* offset of the output of a chunk in `dst`*/
+    size_t caps[MAX_TASKS];         /* room for the output of a chunk or utf8_npos if it needn't run*/
+    size_t results[MAX_TASKS];
+    int errors[MAX_TASKS];
+} mt_job;
+
+/* Splits `len` units of `job->src` into chunks of at least MIN_CHUNK octets, one per thread of `exec`.
+ * return   - number of chunks, 1 if the input is too small to be worth splitting*/
+static size_t split(mt_job *job, const utf8_executor *exec, size_t len, size_t unit_size) {
+    const unsigned char *s;
+    const utf8_char16 *s16;
+    size_t n, i, b, k;
+
+    n = len / (MIN_CHUNK / unit_size);
+    if (n > exec->n_threads) {
+        n = exec->n_threads;
+    }
+    if (n > MAX_TASKS) {
+        n = MAX_TASKS;
+    }
+    if (n <= 1) {
+        return 1;
+    }
+
+    s = (const unsigned char *) job->src;
+    s16 = (const utf8_char16 *) job->src;
+    job->bounds[0] = 0;
+    for (i = 1; i < n; i++) {
+        b = len / n * i;
+        switch (job->kind) {
+            case JOB_FROM_UTF32:
+                break;
+            case JOB_FROM_UTF16:
+                if (IS_LOW_SURROGATE(s16[b]) && IS_HIGH_SURROGATE(s16[b - 1])) {
+                    b--;
+                }
+                break;
+            default:
+                /* Back to the lead octet like utf8_prior. A run of more continuation octets than a code point
+                 * can hold stays in the earlier chunk as a whole, so the first error in it is found there,
+                 * as utf8_validate finds it, and not at the lead octet of a sequence cut off by the boundary*/
+                k = 0;
+                while (k < UTF8C_CP_MAX - 1 && UTF8C_IS_CONT(s[b - k])) {
+                    k++;
+                }
+                if (UTF8C_IS_CONT(s[b - k])) {
+                    while (b < len && UTF8C_IS_CONT(s[b])) {
+                        b++;
+                    }
+                } else {
+                    b -= k;
+                }
+                break;
+        }
+        if (b < job->bounds[i - 1]) { /* Runs crossing several boundaries leave empty chunks*/
+            b = job->bounds[i - 1];
+        }
+        job->bounds[i] = b;
+    }
+    job->bounds[n] = len;
+    job->n_tasks = n;
+    return n;
+}
+
+static void count_task(void *arg, size_t i) {
+    mt_job *job;
+    size_t b, n;
+    const char *s;
+
+    job = (mt_job *) arg;
+    b = job->bounds[i];
+    n = job->bounds[i + 1] - b;
+    s = (const char *) job->src + b;
+    switch (job->kind) {
+        case JOB_DISTANCE:
+        case JOB_TO_UTF32:
+            job->counts[i] = utf8c_count_leads(s, n);
+            break;
+        case JOB_VALIDATE:
+            job->counts[i] = utf8c_validate(s, n);
+            break;
+        case JOB_TO_UTF16:
+            job->counts[i] = utf8c_count_leads(s, n) + utf8c_count_long_leads(s, n);
+            break;
+        case JOB_FROM_UTF32:
+            job->counts[i] = utf8c_len_from_utf32((const utf8_char32 *) job->src + b, n);
+            break;
+        default:
+            job->counts[i] = utf8c_len_from_utf16((const utf8_char16 *) job->src + b, n);
+            break;
+    }
+}
+
+static void convert_task(void *arg, size_t i) {
+    mt_job *job;
+    size_t b, n, cap, res;
+
+    job = (mt_job *) arg;
+    b = job->bounds[i];
+    n = job->bounds[i + 1] - b;
+    cap = job->caps[i];
+    if (cap == utf8_npos) {
+        return;
+    }
+    switch (job->kind) {
+        case JOB_TO_UTF32:
+            res = utf8c_to_utf32((const char *) job->src + b, n,
+                                 (job->dst != NULL) ? (utf8_char32 *) job->dst + job->offsets[i] : NULL, cap);
+            break;
+        case JOB_TO_UTF16:
+            res = utf8c_to_utf16((const char *) job->src + b, n,
+                                 (job->dst != NULL) ? (utf8_char16 *) job->dst + job->offsets[i] : NULL, cap);
+            break;
+        case JOB_FROM_UTF32:
+            res = utf8c_from_utf32((const utf8_char32 *) job->src + b, n,
+                                   (job->dst != NULL) ? (char *) job->dst + job->offsets[i] : NULL, cap);
+            break;
+        default:
+            res = utf8c_from_utf16((const utf8_char16 *) job->src + b, n,
+                                   (job->dst != NULL) ? (char *) job->dst + job->offsets[i] : NULL, cap);
+            break;
+    }
+    job->results[i] = res;
+    job->errors[i] = (res == utf8_npos) ? errno : UTF8_OK;
+}
+
+/* Converts chunks into their own parts of `dst`. Every chunk gets room for its exact output length, cut
+ * where `cap` runs out, so each one fails exactly where the single-threaded conversion would*/
+static size_t transcode(mt_job *job, const utf8_executor *exec, size_t cap) {
+    size_t i, off, total;
+
+    exec->run(exec->ctx, count_task, job, job->n_tasks);
+
+    off = 0;
+    for (i = 0; i < job->n_tasks; i++) {
+        if (off == utf8_npos) {
+            /* An earlier chunk is ill-formed and fails first*/
+            job->caps[i] = utf8_npos;
+            continue;
+        }
+        job->offsets[i] = off;
+        job->caps[i] = (off < cap) ? cap - off : 0;
+        if (job->counts[i] == utf8_npos) {
+            off = utf8_npos;
+            continue;
+        }
+        if (job->caps[i] > job->counts[i]) {
+            job->caps[i] = job->counts[i];
+        }
+        off += job->counts[i];
+    }
+
+    exec->run(exec->ctx, convert_task, job, job->n_tasks);
+
+    total = 0;
+    for (i = 0; i < job->n_tasks; i++) {
+        if (job->results[i] == utf8_npos) {
+            errno = job->errors[i];
+            return utf8_npos;
+        }
+        total += job->results[i];
+    }
+    return total;
+}
+
+size_t utf8_distance_mt(const utf8_executor *exec, const char *begin, const char *end) {
+    mt_job job;
+    size_t i, dist;
+
+    UTF8C_STAT_CALL(utf8_distance_mt, UTF8C_STAT_SPAN(begin, end));
+    if (exec == NULL) {
+        exec = utf8_default_executor();
+    }
+    if (end < begin) {
+        return utf8_distance_mt(exec, end, begin);
+    }
+
+    job.kind = JOB_DISTANCE;
+    job.src = begin;
+    if (split(&job, exec, (size_t) (end - begin), sizeof(char)) == 1) {
+        return utf8_distance(begin, end);
+    }
+    exec->run(exec->ctx, count_task, &job, job.n_tasks);
+
+    dist = 0;
+    for (i = 0; i < job.n_tasks; i++) {
+        dist += job.counts[i];
+    }
+    return dist;
+}
+
+int utf8_validate_mt(const utf8_executor *exec, const char *begin, const char *end, size_t *error_offset) {
+    mt_job job;
+    size_t i;
+
+    UTF8C_STAT_CALL(utf8_validate_mt, UTF8C_STAT_SPAN(begin, end));
+    if (begin == NULL || end == NULL || end < begin) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+    if (exec == NULL) {
+        exec = utf8_default_executor();
+    }
+
+    job.kind = JOB_VALIDATE;
+    job.src = begin;
+    if (split(&job, exec, (size_t) (end - begin), sizeof(char)) == 1) {
+        return utf8_validate(begin, end, error_offset);
+    }
+    exec->run(exec->ctx, count_task, &job, job.n_tasks);
+
+    for (i = 0; i < job.n_tasks; i++) {
+        if (job.counts[i] != job.bounds[i + 1] - job.bounds[i]) {
+            if (error_offset != NULL) {
+                *error_offset = job.bounds[i] + job.counts[i];
+            }
+            errno = UTF8_EILSEQ;
+            return UTF8_EILSEQ;
+        }
+    }
+    return UTF8_OK;
+}
+
+size_t utf8_to_utf32_mt(const utf8_executor *exec, const char *str, size_t len, utf8_char32 *dst, size_t cap) {
+    mt_job job;
+
+    UTF8C_STAT_CALL(utf8_to_utf32_mt, len);
+    if ((str == NULL && len != 0) || (dst == NULL && cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    if (exec == NULL) {
+        exec = utf8_default_executor();
+    }
+
+    job.kind = JOB_TO_UTF32;
+    job.src = str;
+    job.dst = dst;
+    if (split(&job, exec, len, sizeof(char)) == 1) {
+        return utf8c_to_utf32(str, len, dst, cap);
+    }
+    return transcode(&job, exec, cap);
+}
+
+size_t utf8_to_utf16_mt(const utf8_executor *exec, const char *str, size_t len, utf8_char16 *dst, size_t cap) {
+    mt_job job;
+
+    UTF8C_STAT_CALL(utf8_to_utf16_mt, len);
+    if ((str == NULL && len != 0) || (dst == NULL && cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    if (exec == NULL) {
+        exec = utf8_default_executor();
+    }
+
+    job.kind = JOB_TO_UTF16;
+    job.src = str;
+    job.dst = dst;
+    if (split(&job, exec, len, sizeof(char)) == 1) {
+        return utf8c_to_utf16(str, len, dst, cap);
+    }
+    return transcode(&job, exec, cap);
+}
+
+size_t utf8_from_utf32_mt(const utf8_executor *exec, const utf8_char32 *src, size_t n, char *dst, size_t cap) {
+    mt_job job;
+
+    UTF8C_STAT_CALL(utf8_from_utf32_mt, 0);
+    if ((src == NULL && n != 0) || (dst == NULL && cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    if (exec == NULL) {
+        exec = utf8_default_executor();
+    }
+
+    job.kind = JOB_FROM_UTF32;
+    job.src = src;
+    job.dst = dst;
+    if (split(&job, exec, n, sizeof(utf8_char32)) == 1) {
+        return utf8c_from_utf32(src, n, dst, cap);
+    }
+    return transcode(&job, exec, cap);
+}
+
+size_t utf8_from_utf16_mt(const utf8_executor *exec, const utf8_char16 *src, size_t n, char *dst, size_t cap) {
+    mt_job job;
+
+    UTF8C_STAT_CALL(utf8_from_utf16_mt, 0);
+    if ((src == NULL && n != 0) || (dst == NULL && cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    if (exec == NULL) {
+        exec = utf8_default_executor();
+    }
+
+    job.kind = JOB_FROM_UTF16;
+    job.src = src;
+    job.dst = dst;
+    if (split(&job, exec, n, sizeof(utf8_char16)) == 1) {
+        return utf8c_from_utf16(src, n, dst, cap);
+    }
+    return transcode(&job, exec, cap);
+}
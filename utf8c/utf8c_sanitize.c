@@ -0,0 +1,208 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Replacement of ill-formed sequences with U+FFFD. Well-formed runs are found by the validate kernel and copied
+ * in bulk, only the octets at the errors it reports are looked at one by one*/
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_into.h"
+#include "utf8c_stats.h"
+
+/* U+FFFD REPLACEMENT CHARACTER*/
+#define REPLACEMENT "\xEF\xBF\xBD"
+#define REPLACEMENT_LEN 3
+
+/* Where the output goes: a caller buffer, a builder, memory that overlaps the input behind the read position
+ * or nowhere, when only the size of the result is needed*/
+typedef struct sanitize_sink {
+    utf8c_into *into;
+    utf8_builder *builder;
+    char *dst;
+    size_t total;           /* Number of octets of output so far*/
+    size_t replaced;        /* Number of replacements so far*/
+    int error;              /* UTF8_OK, UTF8_ENOMEM or UTF8_ERANGE*/
+} sanitize_sink;
+
+/* `s`      - pointer to an octet validation stopped at, before `end`
+ * return   - number of octets in the maximal subpart that starts at `s`: the lead octet and continuation octets
+ *     in the ranges of table 3-7 of the Unicode standard, up to the first one that isn't. At least 1*/
+static size_t maximal_subpart(const unsigned char *s, const unsigned char *end) {
+    unsigned char c, lo, hi;
+    size_t n, k;
+
+    c = s[0];
+    if (c < 0xC2 || c >= 0xF5) { /* Stray continuation octet or an octet that never starts a sequence*/
+        return 1;
+    }
+    n = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : 2;
+
+    /* Allowed range of the second octet, the rest are plain continuation octets*/
+    lo = 0x80;
+    hi = 0xBF;
+    if (c == 0xE0) {
+        lo = 0xA0; /* Overlong*/
+    } else if (c == 0xED) {
+        hi = 0x9F; /* Surrogates*/
+    } else if (c == 0xF0) {
+        lo = 0x90; /* Overlong*/
+    } else if (c == 0xF4) {
+        hi = 0x8F; /* Above U+10FFFF*/
+    }
+    for (k = 1; k < n && s + k < end && s[k] >= lo && s[k] <= hi; k++) {
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    return k;
+}
+
+static void emit(sanitize_sink *sink, const char *s, size_t n) {
+    if (sink->error != UTF8_OK || n == 0) {
+        return;
+    }
+    if (n > (size_t) -1 - 1 - sink->total) {
+        sink->error = UTF8_ERANGE;
+        return;
+    }
+
+    if (sink->into != NULL) {
+        utf8c_into_put(sink->into, s, n);
+    } else if (sink->builder != NULL) {
+        sink->error = utf8_builder_append(sink->builder, s, n);
+    } else if (sink->dst != NULL && sink->dst + sink->total != s) {
+        memmove(sink->dst + sink->total, s, sizeof(char) * n);
+    }
+    sink->total += n;
+}
+
+static void sanitize(sanitize_sink *sink, const char *str, size_t len) {
+    size_t i, j, n;
+
+    i = 0;
+    while (sink->error == UTF8_OK) {
+        j = i + utf8c_validate(str + i, len - i);
+        emit(sink, str + i, j - i);
+        if (j == len) {
+            break;
+        }
+        /* Measured before the replacement is written, which may overwrite it when sanitizing in place*/
+        n = maximal_subpart((const unsigned char *) str + j, (const unsigned char *) str + len);
+        emit(sink, REPLACEMENT, REPLACEMENT_LEN);
+        sink->replaced++;
+        i = j + n;
+    }
+}
+
+size_t utf8_sanitize(char *str, size_t len, size_t cap) {
+    sanitize_sink sink;
+    size_t off, tail, total;
+
+    UTF8C_STAT_CALL(utf8_sanitize, len);
+    if (str == NULL || cap < len) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    off = utf8c_validate(str, len);
+    if (off == len) {
+        UTF8C_STAT_ADD(fast, 1);
+        return len;
+    }
+
+    /* Only the size first, nothing is written unless the result fits*/
+    memset(&sink, 0, sizeof(sink));
+    sanitize(&sink, str + off, len - off);
+    if (sink.error != UTF8_OK) {
+        errno = sink.error;
+        return utf8_npos;
+    }
+    UTF8C_STAT_ADD(slow, sink.replaced);
+    total = off + sink.total;
+    if (total > cap) {
+        return total;
+    }
+
+    /* Replacements are never shorter than what they replace, so with the rest moved to the end of the buffer
+     * the output written from `off` onwards never catches up with the input still to be read*/
+    tail = len - off;
+    memmove(str + cap - tail, str + off, sizeof(char) * tail);
+    memset(&sink, 0, sizeof(sink));
+    sink.dst = str + off;
+    sanitize(&sink, str + cap - tail, tail);
+    return total;
+}
+
+size_t utf8_sanitize_into(char *dst, size_t dst_cap, const char *str, size_t len) {
+    utf8c_into out;
+    sanitize_sink sink;
+
+    UTF8C_STAT_CALL(utf8_sanitize_into, len);
+    if (str == NULL || (dst == NULL && dst_cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+
+    utf8c_into_begin(&out, dst, dst_cap);
+    memset(&sink, 0, sizeof(sink));
+    sink.into = &out;
+    sanitize(&sink, str, len);
+    UTF8C_STAT_ADD(fast, sink.replaced == 0);
+    UTF8C_STAT_ADD(slow, sink.replaced);
+    if (sink.error != UTF8_OK) {
+        errno = sink.error;
+        return utf8_npos;
+    }
+    return utf8c_into_end(&out, dst_cap, sink.total);
+}
+
+int utf8_builder_append_sanitized(utf8_builder *builder, const char *str, size_t len) {
+    sanitize_sink sink;
+    size_t old_len, old_n_cps;
+
+    UTF8C_STAT_CALL(utf8_builder_append_sanitized, len);
+    if (builder == NULL || str == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    old_len = builder->len;
+    old_n_cps = builder->n_cps;
+    memset(&sink, 0, sizeof(sink));
+    sink.builder = builder;
+    sanitize(&sink, str, len);
+    UTF8C_STAT_RESUME(utf8_builder_append_sanitized);
+    UTF8C_STAT_ADD(fast, sink.replaced == 0);
+    UTF8C_STAT_ADD(slow, sink.replaced);
+    if (sink.error != UTF8_OK) { /* Leave the builder as it was*/
+        builder->len = old_len;
+        builder->n_cps = old_n_cps;
+        if (builder->data != NULL) {
+            builder->data[old_len] = '\0';
+        }
+        errno = sink.error;
+        return sink.error;
+    }
+    return UTF8_OK;
+}
@@ -0,0 +1,324 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+
+#if defined(UTF8C_DISPATCH) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+size_t utf8c_encode(utf8_char32 cp, char *dst) {
+    if (cp < 0x80) {
+        dst[0] = (char) cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        dst[0] = (char) (0xC0 | (cp >> 6));
+        dst[1] = (char) (0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        dst[0] = (char) (0xE0 | (cp >> 12));
+        dst[1] = (char) (0x80 | ((cp >> 6) & 0x3F));
+        dst[2] = (char) (0x80 | (cp & 0x3F));
+        return 3;
+    }
+    dst[0] = (char) (0xF0 | (cp >> 18));
+    dst[1] = (char) (0x80 | ((cp >> 12) & 0x3F));
+    dst[2] = (char) (0x80 | ((cp >> 6) & 0x3F));
+    dst[3] = (char) (0x80 | (cp & 0x3F));
+    return 4;
+}
+
+
+static const char *const isa_names[] = {"scalar", "sse2", "ssse3", "avx2", "avx512"};
+
+static volatile int isa_detected = -1;
+
+#if defined(UTF8C_DISPATCH) && defined(_MSC_VER)
+static int detect(void) {
+    int regs[4];
+    int max_leaf;
+    unsigned long long xcr0 = 0;
+
+    __cpuid(regs, 0);
+    max_leaf = regs[0];
+    __cpuid(regs, 1);
+    if (!(regs[3] & (1 << 26))) {
+        return UTF8_ISA_SCALAR;
+    }
+    if (!(regs[2] & (1 << 9))) {
+        return UTF8_ISA_SSE2;
+    }
+    /* AVX registers must be enabled by the OS (OSXSAVE and XCR0), not only supported by the CPU*/
+    if ((regs[2] & (1 << 27)) && (regs[2] & (1 << 28))) {
+        xcr0 = _xgetbv(0);
+    }
+    if (max_leaf < 7 || (xcr0 & 0x6) != 0x6) {
+        return UTF8_ISA_SSSE3;
+    }
+    __cpuidex(regs, 7, 0);
+    if (!(regs[1] & (1 << 5))) {
+        return UTF8_ISA_SSSE3;
+    }
+    if ((regs[1] & (1 << 16)) && (regs[1] & (1 << 30)) && (xcr0 & 0xE6) == 0xE6) {
+        return UTF8_ISA_AVX512;
+    }
+    return UTF8_ISA_AVX2;
+}
+#elif defined(UTF8C_DISPATCH)
+static int detect(void) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return UTF8_ISA_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return UTF8_ISA_AVX2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return UTF8_ISA_SSSE3;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return UTF8_ISA_SSE2;
+    }
+    return UTF8_ISA_SCALAR;
+}
+#else
+static int detect(void) {
+    return UTF8_ISA_SCALAR;
+}
+#endif
+
+static const utf8c_kernels stub_kernels;
+
+const utf8c_kernels *volatile utf8c_active = &stub_kernels;
+
+static const utf8c_kernels *kernels_of(int isa) {
+    switch (isa) {
+#if defined(UTF8C_DISPATCH)
+        case UTF8_ISA_AVX512:
+            return &utf8c_avx512_kernels;
+        case UTF8_ISA_AVX2:
+            return &utf8c_avx2_kernels;
+        case UTF8_ISA_SSSE3:
+            return &utf8c_ssse3_kernels;
+        case UTF8_ISA_SSE2:
+            return &utf8c_sse2_kernels;
+#endif
+        default:
+            return &utf8c_scalar_kernels;
+    }
+}
+
+/* Picks kernels on the first call. Threads racing here all publish the same table, with a single atomic store*/
+static void init(void) {
+    const char *env;
+    int isa;
+
+    if (UTF8C_ACTIVE != &stub_kernels) {
+        return;
+    }
+    isa = utf8_detect_isa();
+    env = getenv("UTF8C_ISA");
+    if (env != NULL) {
+        int i;
+        for (i = 0; i <= isa; i++) {
+            if (strcmp(env, isa_names[i]) == 0) {
+                isa = i;
+                break;
+            }
+        }
+    }
+    UTF8C_STORE_RELEASE(utf8c_active, kernels_of(isa));
+}
+
+/* Stubs that utf8c_active starts with: they bind the kernels and forward the call*/
+static size_t stub_count_leads(const char *s, size_t len) {
+    init();
+    return utf8c_count_leads(s, len);
+}
+
+static size_t stub_count_long_leads(const char *s, size_t len) {
+    init();
+    return utf8c_count_long_leads(s, len);
+}
+
+static void stub_count_leads_batch(const char *data, const size_t *offsets, size_t n, size_t *out) {
+    init();
+    utf8c_count_leads_batch(data, offsets, n, out);
+}
+
+static size_t stub_skip_forward(const char *s, size_t len, size_t *n) {
+    init();
+    return utf8c_skip_forward(s, len, n);
+}
+
+static size_t stub_skip_backward(const char *s, size_t len, size_t *n) {
+    init();
+    return utf8c_skip_backward(s, len, n);
+}
+
+static size_t stub_skip_ascii(const char *s, size_t len) {
+    init();
+    return utf8c_skip_ascii(s, len);
+}
+
+static size_t stub_skip_below(const char *s, size_t len, unsigned char limit) {
+    init();
+    return utf8c_skip_below(s, len, limit);
+}
+
+static size_t stub_skip_folded_ascii(const char *s, size_t len) {
+    init();
+    return utf8c_skip_folded_ascii(s, len);
+}
+
+static size_t stub_find(const char *s, size_t len, const char *needle, size_t needle_len) {
+    init();
+    return utf8c_find(s, len, needle, needle_len);
+}
+
+static size_t stub_find_any(const char *s, size_t len, const unsigned char *octets, size_t n,
+                            unsigned long *hits) {
+    init();
+    return utf8c_find_any(s, len, octets, n, hits);
+}
+
+static size_t stub_validate(const char *s, size_t len) {
+    init();
+    return utf8c_validate(s, len);
+}
+
+static void stub_reverse(char *s, size_t len) {
+    init();
+    utf8c_reverse(s, len);
+}
+
+static void stub_reverse_copy(const char *s, size_t len, char *dst) {
+    init();
+    utf8c_reverse_copy(s, len, dst);
+}
+
+static size_t stub_join(const char *s, size_t len, const char *joiner, size_t joiner_len, char *dst) {
+    init();
+    return utf8c_join(s, len, joiner, joiner_len, dst);
+}
+
+static size_t stub_to_utf32(const char *str, size_t len, utf8_char32 *dst, size_t cap) {
+    init();
+    return utf8c_to_utf32(str, len, dst, cap);
+}
+
+static size_t stub_to_utf16(const char *str, size_t len, utf8_char16 *dst, size_t cap) {
+    init();
+    return utf8c_to_utf16(str, len, dst, cap);
+}
+
+static size_t stub_from_utf32(const utf8_char32 *src, size_t n, char *dst, size_t cap) {
+    init();
+    return utf8c_from_utf32(src, n, dst, cap);
+}
+
+static size_t stub_from_utf16(const utf8_char16 *src, size_t n, char *dst, size_t cap) {
+    init();
+    return utf8c_from_utf16(src, n, dst, cap);
+}
+
+static size_t stub_len_from_utf32(const utf8_char32 *src, size_t n) {
+    init();
+    return utf8c_len_from_utf32(src, n);
+}
+
+static size_t stub_len_from_utf16(const utf8_char16 *src, size_t n) {
+    init();
+    return utf8c_len_from_utf16(src, n);
+}
+
+static const utf8c_kernels stub_kernels = {
+        stub_count_leads,
+        stub_count_long_leads,
+        stub_count_leads_batch,
+        stub_skip_forward,
+        stub_skip_backward,
+        stub_skip_ascii,
+        stub_skip_below,
+        stub_skip_folded_ascii,
+        stub_find,
+        stub_find_any,
+        stub_validate,
+        stub_reverse,
+        stub_reverse_copy,
+        stub_join,
+        stub_to_utf32,
+        stub_to_utf16,
+        stub_from_utf32,
+        stub_from_utf16,
+        stub_len_from_utf32,
+        stub_len_from_utf16
+};
+
+int utf8_detect_isa(void) {
+    int isa;
+
+    isa = UTF8C_LOAD_ACQUIRE(isa_detected);
+    if (isa < 0) {
+        isa = detect();
+        UTF8C_STORE_RELEASE(isa_detected, isa);
+    }
+    return isa;
+}
+
+int utf8_get_isa(void) {
+    const utf8c_kernels *active;
+    int isa;
+
+    init();
+    active = UTF8C_ACTIVE;
+    isa = UTF8_ISA_SCALAR;
+    while (isa < UTF8_ISA_AVX512 && kernels_of(isa) != active) {
+        isa++;
+    }
+    return isa;
+}
+
+int utf8_set_isa(int isa) {
+    if (isa < UTF8_ISA_SCALAR || isa > utf8_detect_isa()) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+    UTF8C_STORE_RELEASE(utf8c_active, kernels_of(isa));
+    return UTF8_OK;
+}
+
+const char *utf8_isa_name(int isa) {
+    if (isa < UTF8_ISA_SCALAR || isa > UTF8_ISA_AVX512) {
+        return NULL;
+    }
+    return isa_names[isa];
+}
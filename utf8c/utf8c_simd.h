@@ -0,0 +1,201 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Internal kernels shared by utf8c translation units. Not part of the public API.*/
+#ifndef UTF8C_SIMD_H
+#define UTF8C_SIMD_H
+
+#include <stddef.h>
+#include "utf8c.h"
+
+/* Kernels of every x86 instruction set are compiled regardless of compiler flags and picked at run time.
+ * Needs a compiler that can target an instruction set per translation unit*/
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))) \
+    || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define UTF8C_DISPATCH 1
+#endif
+
+/* Octet is the first octet of a code point (anything but 10xxxxxx)*/
+#define UTF8C_IS_LEAD(c) (((unsigned char) (c) & 0xC0) != 0x80)
+#define UTF8C_IS_CONT(c) (((unsigned char) (c) & 0xC0) == 0x80)
+
+/* Maximum number of octets in a code point*/
+#define UTF8C_CP_MAX 4
+
+/* `cp`     - valid unicode scalar value (not a surrogate and not above U+10FFFF)
+ * `dst`    - pointer to at least UTF8C_CP_MAX octets
+ * return   - number of octets written to `dst`*/
+size_t utf8c_encode(utf8_char32 cp, char *dst);
+
+/* Maximum number of octets find_any looks for at once*/
+#define UTF8C_FIND_ANY_MAX 16
+
+/* Number of octets find_any reports hits for*/
+#define UTF8C_FIND_ANY_SPAN 32
+
+/* Kernels compiled for one instruction set, see utf8c_kernels.inc*/
+typedef struct utf8c_kernels {
+    /* `s`      - pointer to a string
+     * `len`    - number of octets to scan
+     * return   - number of octets in [s, s + len) that are not continuation octets (10xxxxxx)*/
+    size_t (*count_leads)(const char *s, size_t len);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets to scan
+     * return   - number of octets in [s, s + len) that start 4-octet sequences (0xF0 and above),
+     *     i.e. the number of code points that take a surrogate pair in utf-16*/
+    size_t (*count_long_leads)(const char *s, size_t len);
+
+    /* `data`   - pointer to the octets of all the strings
+     * `offsets` - `n` + 1 non-decreasing offsets, string `i` is [data + offsets[i], data + offsets[i + 1])
+     * `out`    - pointer to `n` elements that receive the number of lead octets of every string*/
+    void (*count_leads_batch)(const char *data, const size_t *offsets, size_t n, size_t *out);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets in `s`
+     * `n`      - number of lead octets to skip, decreased by the number of lead octets skipped
+     * return   - number of octets from the beginning of `s` skipped in whole blocks. Stops before a block holding
+     *     more than `n` lead octets, so the end of the result is at most one block and one code point away*/
+    size_t (*skip_forward)(const char *s, size_t len, size_t *n);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets in `s`
+     * `n`      - number of lead octets to skip, decreased by the number of lead octets skipped
+     * return   - number of octets from the end of `s` skipped in whole blocks. Stops before a block holding
+     *     `n` or more lead octets, so that the last code point is always found by a scan*/
+    size_t (*skip_backward)(const char *s, size_t len, size_t *n);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets in `s`
+     * return   - number of ASCII octets at the beginning of `s`*/
+    size_t (*skip_ascii)(const char *s, size_t len);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets in `s`
+     * `limit`  - octet value to stop at, 0x80 or more
+     * return   - number of octets below `limit` at the beginning of `s`*/
+    size_t (*skip_below)(const char *s, size_t len, unsigned char limit);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets in `s`
+     * return   - number of ASCII octets but 'A'..'Z' at the beginning of `s`*/
+    size_t (*skip_folded_ascii)(const char *s, size_t len);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets in `s`
+     * `needle` - pointer to a string to look for, at least one octet long
+     * `needle_len` - number of octets in `needle`
+     * return   - offset of the first occurrence of `needle` in `s` or `len` if there's none. Octets are compared
+     *     as they are, code point boundaries aren't checked*/
+    size_t (*find)(const char *s, size_t len, const char *needle, size_t needle_len);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets in `s`
+     * `octets` - pointer to the octet values to look for
+     * `n`      - number of `octets`, from 1 to UTF8C_FIND_ANY_MAX
+     * `hits`   - pointer to a variable that receives a bit for each of the UTF8C_FIND_ANY_SPAN octets (or as many
+     *     as are left) from the returned offset on that's one of `octets`, bit 0 for the returned offset itself
+     * return   - offset of the first octet of `s` that is one of `octets` or `len` if there's none*/
+    size_t (*find_any)(const char *s, size_t len, const unsigned char *octets, size_t n, unsigned long *hits);
+
+    /* `s`      - pointer to a string
+     * `len`    - number of octets to validate
+     * return   - offset of the first octet of the first ill-formed (overlong, surrogate, out of range,
+     *     stray continuation or truncated) sequence in [s, s + len) or `len` if the whole range is valid UTF-8*/
+    size_t (*validate)(const char *s, size_t len);
+
+    /* Reverses the order of code points of `s` in place. A code point is a lead octet with all of the continuation
+     * octets after it, continuation octets at the beginning of `s` make up one more
+     * `s`      - pointer to a string
+     * `len`    - number of octets in `s`*/
+    void (*reverse)(char *s, size_t len);
+
+    /* Same as `reverse`, but writes the result to `dst`
+     * `dst`    - pointer to at least `len` octets, mustn't overlap with `s`*/
+    void (*reverse_copy)(const char *s, size_t len, char *dst);
+
+    /* Copies `s` to `dst` with `joiner` before every lead octet but the one at the beginning
+     * `dst`    - pointer to len + joiner_len * (number of such lead octets) octets, mustn't overlap with `s`
+     * return   - number of octets written to `dst`, nothing is appended*/
+    size_t (*join)(const char *s, size_t len, const char *joiner, size_t joiner_len, char *dst);
+
+    /* Same as utf8_to_utf32, utf8_to_utf16, utf8_from_utf32 and utf8_from_utf16, without argument checks*/
+    size_t (*to_utf32)(const char *str, size_t len, utf8_char32 *dst, size_t cap);
+    size_t (*to_utf16)(const char *str, size_t len, utf8_char16 *dst, size_t cap);
+    size_t (*from_utf32)(const utf8_char32 *src, size_t n, char *dst, size_t cap);
+    size_t (*from_utf16)(const utf8_char16 *src, size_t n, char *dst, size_t cap);
+
+    /* Same as utf8_len_from_utf32 and utf8_len_from_utf16, without argument checks*/
+    size_t (*len_from_utf32)(const utf8_char32 *src, size_t n);
+    size_t (*len_from_utf16)(const utf8_char16 *src, size_t n);
+} utf8c_kernels;
+
+extern const utf8c_kernels utf8c_scalar_kernels;
+#if defined(UTF8C_DISPATCH)
+extern const utf8c_kernels utf8c_sse2_kernels;
+extern const utf8c_kernels utf8c_ssse3_kernels;
+extern const utf8c_kernels utf8c_avx2_kernels;
+extern const utf8c_kernels utf8c_avx512_kernels;
+#endif
+
+/* Loads and stores of variables threads share without a lock. Only aligned pointers and ints are accessed
+ * this way and they point to constant tables, so atomic accesses of volatile objects are enough elsewhere*/
+#if defined(__GNUC__)
+#define UTF8C_LOAD_ACQUIRE(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define UTF8C_STORE_RELEASE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define UTF8C_LOAD_ACQUIRE(x) (x)
+#define UTF8C_STORE_RELEASE(x, v) ((void) ((x) = (v)))
+#endif
+
+/* Kernels of the instruction set in use. Until the first call they point to stubs that detect CPU features
+ * and bind the best kernels. Threads racing to bind them publish the same table*/
+extern const utf8c_kernels *volatile utf8c_active;
+
+#define UTF8C_ACTIVE (UTF8C_LOAD_ACQUIRE(utf8c_active))
+
+#define utf8c_count_leads(s, len) (UTF8C_ACTIVE->count_leads((s), (len)))
+#define utf8c_count_long_leads(s, len) (UTF8C_ACTIVE->count_long_leads((s), (len)))
+#define utf8c_count_leads_batch(data, offsets, n, out) \
+        (UTF8C_ACTIVE->count_leads_batch((data), (offsets), (n), (out)))
+#define utf8c_skip_forward(s, len, n) (UTF8C_ACTIVE->skip_forward((s), (len), (n)))
+#define utf8c_skip_backward(s, len, n) (UTF8C_ACTIVE->skip_backward((s), (len), (n)))
+#define utf8c_skip_ascii(s, len) (UTF8C_ACTIVE->skip_ascii((s), (len)))
+#define utf8c_skip_below(s, len, limit) (UTF8C_ACTIVE->skip_below((s), (len), (limit)))
+#define utf8c_skip_folded_ascii(s, len) (UTF8C_ACTIVE->skip_folded_ascii((s), (len)))
+#define utf8c_find(s, len, needle, needle_len) (UTF8C_ACTIVE->find((s), (len), (needle), (needle_len)))
+#define utf8c_find_any(s, len, octets, n, hits) (UTF8C_ACTIVE->find_any((s), (len), (octets), (n), (hits)))
+#define utf8c_validate(s, len) (UTF8C_ACTIVE->validate((s), (len)))
+#define utf8c_reverse(s, len) (UTF8C_ACTIVE->reverse((s), (len)))
+#define utf8c_reverse_copy(s, len, dst) (UTF8C_ACTIVE->reverse_copy((s), (len), (dst)))
+#define utf8c_join(s, len, joiner, joiner_len, dst) \
+        (UTF8C_ACTIVE->join((s), (len), (joiner), (joiner_len), (dst)))
+#define utf8c_to_utf32(str, len, dst, cap) (UTF8C_ACTIVE->to_utf32((str), (len), (dst), (cap)))
+#define utf8c_to_utf16(str, len, dst, cap) (UTF8C_ACTIVE->to_utf16((str), (len), (dst), (cap)))
+#define utf8c_from_utf32(src, n, dst, cap) (UTF8C_ACTIVE->from_utf32((src), (n), (dst), (cap)))
+#define utf8c_from_utf16(src, n, dst, cap) (UTF8C_ACTIVE->from_utf16((src), (n), (dst), (cap)))
+#define utf8c_len_from_utf32(src, n) (UTF8C_ACTIVE->len_from_utf32((src), (n)))
+#define utf8c_len_from_utf16(src, n) (UTF8C_ACTIVE->len_from_utf16((src), (n)))
+
+#endif /* UTF8C_SIMD_H*/
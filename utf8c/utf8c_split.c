@@ -0,0 +1,251 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Splitting strings into views. Delimiters are located with the vector kernels over whole blocks: strings and
+ * code points through utf8_find, sets of code points by the find_any kernel on their distinct first octets*/
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_stats.h"
+
+static void split_begin(utf8_split *split, const char *str, size_t len, unsigned int flags) {
+    split->rest.ptr = str;
+    split->rest.len = len;
+    split->delim = NULL;
+    split->delim_len = 0;
+    split->flags = flags;
+    split->done = 0;
+    split->n_firsts = 0;
+    split->hits = 0;
+    split->span = 0;
+}
+
+int utf8_split_init(utf8_split *split, const char *str, size_t len, const char *delim, size_t delim_len,
+                    unsigned int flags) {
+    UTF8C_STAT_CALL(utf8_split_init, len);
+    if (split == NULL || str == NULL || delim == NULL || delim_len == 0) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+    split_begin(split, str, len, flags);
+    split->delim = delim;
+    split->delim_len = delim_len;
+    return UTF8_OK;
+}
+
+int utf8_split_init_cp(utf8_split *split, const char *str, size_t len, utf8_char32 cp, unsigned int flags) {
+    UTF8C_STAT_CALL(utf8_split_init_cp, len);
+    if (split == NULL || str == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+    if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        errno = UTF8_EILSEQ;
+        return UTF8_EILSEQ;
+    }
+    split_begin(split, str, len, flags);
+    /* Kept inside the iterator rather than pointed to by `delim`, so copies of it stay usable*/
+    split->delim_len = utf8c_encode(cp, split->cp);
+    return UTF8_OK;
+}
+
+int utf8_split_init_set(utf8_split *split, const char *str, size_t len, const char *set, size_t set_len,
+                        unsigned int flags) {
+    size_t i;
+    unsigned char c;
+
+    UTF8C_STAT_CALL(utf8_split_init_set, len);
+    if (split == NULL || str == NULL || set == NULL || set_len == 0) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+    split_begin(split, str, len, flags);
+    split->delim = set;
+    split->delim_len = set_len;
+    memset(split->first_bits, 0, sizeof(split->first_bits));
+    for (i = 0; i < set_len; i++) {
+        c = (unsigned char) set[i];
+        if (UTF8C_IS_CONT(c) || (split->first_bits[c >> 3] & (1u << (c & 7))) != 0) {
+            continue;
+        }
+        split->first_bits[c >> 3] |= (unsigned char) (1u << (c & 7));
+        if (split->n_firsts < sizeof(split->firsts)) {
+            split->firsts[split->n_firsts] = c;
+        }
+        split->n_firsts++;
+    }
+    if (split->n_firsts == 0) {
+        errno = UTF8_EINVAL;  /* Continuation octets only*/
+        return UTF8_EINVAL;
+    }
+    return UTF8_OK;
+}
+
+/* return   - number of octets of the code point of the set `split` that `s` begins with, or 0 if there's none*/
+static size_t set_member(const utf8_split *split, const char *s, size_t len) {
+    size_t i, n;
+
+    if ((unsigned char) s[0] < 0x80) {
+        /* An ASCII first octet is the whole code point*/
+        return (len == 1 || !UTF8C_IS_CONT(s[1])) ? 1 : 0;
+    }
+    for (i = 0; i < split->delim_len; i += n) {
+        for (n = 1; i + n < split->delim_len && UTF8C_IS_CONT(split->delim[i + n]); n++) {
+        }
+        if (split->delim[i] == s[0] && n <= len && memcmp(split->delim + i, s, n) == 0
+            && (n == len || !UTF8C_IS_CONT(s[n]))) {
+            return n;
+        }
+    }
+    return 0;
+}
+
+/* return   - index of the lowest set bit of a non-zero `x`*/
+static size_t lowest_bit(unsigned long x) {
+    size_t n;
+
+    for (n = 0; (x & 0xFF) == 0; n += 8) {
+        x >>= 8;
+    }
+    for (; (x & 1) == 0; n++) {
+        x >>= 1;
+    }
+    return n;
+}
+
+/* Drops `n` octets from the beginning of the span of hits of `split`*/
+static void drop_hits(utf8_split *split, size_t n) {
+    if (n >= split->span) {
+        split->hits = 0;
+        split->span = 0;
+    } else {
+        split->hits >>= n;
+        split->span -= n;
+    }
+}
+
+/* Candidates are the octets that are first octets of the set, the find_any kernel reports all of them in a span
+ * of octets at once, so the following pieces are found from `split->hits` alone
+ * `s`      - pointer to the rest of the string, the hits of `split` are relative to it
+ * `match_len` - pointer to a variable that receives the number of octets of the delimiter found, 0 if there's none
+ * return   - offset of the first delimiter of the set in `s` or `len` if there's none. The hits of `split` are
+ *     left relative to the octet after the delimiter*/
+static size_t find_set(utf8_split *split, const char *s, size_t len, size_t *match_len) {
+    size_t at, off;
+    unsigned char c;
+
+    *match_len = 0;
+    at = 0;
+    for (;;) {
+        if (split->hits == 0) {
+            at += split->span;
+            split->span = 0;
+            if (at >= len) {
+                return len;
+            }
+            if (split->n_firsts <= sizeof(split->firsts)) {
+                off = utf8c_find_any(s + at, len - at, split->firsts, split->n_firsts, &split->hits);
+                split->span = (len - at - off < UTF8C_FIND_ANY_SPAN) ? len - at - off : UTF8C_FIND_ANY_SPAN;
+            } else {
+                for (off = 0; at + off < len; off++) {
+                    c = (unsigned char) s[at + off];
+                    if ((split->first_bits[c >> 3] & (1u << (c & 7))) != 0) {
+                        break;
+                    }
+                }
+                split->hits = 1;
+                split->span = 1;
+            }
+            if (at + off == len) {
+                split->hits = 0;
+                split->span = 0;
+                return len;
+            }
+            at += off;
+        }
+        off = lowest_bit(split->hits);
+        at += off;
+        drop_hits(split, off + 1);
+        *match_len = set_member(split, s + at, len - at);
+        if (*match_len != 0) {
+            drop_hits(split, *match_len - 1);
+            return at;
+        }
+        at++;
+    }
+}
+
+/* `match_len` - pointer to a variable that receives the number of octets of the delimiter found
+ * return   - offset of the first delimiter in `s` or `len` if there's none*/
+static size_t find_delim(utf8_split *split, const char *s, size_t len, size_t *match_len) {
+    const char *delim, *p;
+    size_t at;
+
+    if (split->n_firsts != 0) {
+        return find_set(split, s, len, match_len);
+    }
+    delim = (split->delim != NULL) ? split->delim : split->cp;
+    *match_len = split->delim_len;
+    if (split->delim_len != 1 || (unsigned char) delim[0] >= 0x80) {
+        p = utf8_find(s, len, delim, split->delim_len, NULL);
+        return (p != NULL) ? (size_t) (p - s) : len;
+    }
+    /* ASCII octets never occur inside multi-octet sequences, only stray continuation octets can follow them*/
+    for (at = 0; (p = (const char *) memchr(s + at, delim[0], len - at)) != NULL; at = (size_t) (p - s) + 1) {
+        if (p + 1 == s + len || !UTF8C_IS_CONT(p[1])) {
+            return (size_t) (p - s);
+        }
+    }
+    return len;
+}
+
+int utf8_split_next(utf8_split *split, utf8_view *piece) {
+    size_t off, match_len;
+
+    UTF8C_STAT_CALL(utf8_split_next, 0);
+    if (split == NULL || piece == NULL || split->rest.ptr == NULL) {
+        errno = UTF8_EINVAL;
+        return 0;
+    }
+
+    while (!split->done) {
+        off = find_delim(split, split->rest.ptr, split->rest.len, &match_len);
+        piece->ptr = split->rest.ptr;
+        piece->len = off;
+        UTF8C_STAT_ADD(octets, (off == split->rest.len) ? off : off + match_len);
+        if (off == split->rest.len) {
+            split->rest.ptr += off;
+            split->rest.len = 0;
+            split->done = 1;
+        } else {
+            split->rest.ptr += off + match_len;
+            split->rest.len -= off + match_len;
+        }
+        if (piece->len != 0 || !(split->flags & UTF8_SPLIT_SKIP_EMPTY)) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <string.h>
+#include "utf8c.h"
+#include "utf8c_stats.h"
+
+#if defined(UTF8C_STATS)
+UTF8C_THREAD_LOCAL utf8_stat utf8c_stats[UTF8C_STAT_COUNT];
+UTF8C_THREAD_LOCAL size_t utf8c_stats_current;
+
+#define UTF8C_STAT_NAME(fn) #fn,
+static const char *const stat_names[UTF8C_STAT_COUNT] = {
+        UTF8C_STAT_FUNCS(UTF8C_STAT_NAME)
+};
+#undef UTF8C_STAT_NAME
+
+size_t utf8c_strlen(const char *str) {
+    size_t len;
+
+    len = strlen(str);
+    utf8c_stats[utf8c_stats_current].strlens++;
+    utf8c_stats[utf8c_stats_current].octets += len;
+    return len;
+}
+#endif
+
+size_t utf8_stats_snapshot(utf8_stat *dst, size_t cap) {
+#if defined(UTF8C_STATS)
+    size_t i, n;
+
+    n = 0;
+    for (i = 0; i < UTF8C_STAT_COUNT; i++) {
+        if (utf8c_stats[i].calls == 0) {
+            continue;
+        }
+        if (dst != NULL && n < cap) {
+            dst[n] = utf8c_stats[i];
+            dst[n].name = stat_names[i];
+        }
+        n++;
+    }
+    return n;
+#else
+    (void) dst;
+    (void) cap;
+    return 0;
+#endif
+}
+
+void utf8_stats_reset(void) {
+#if defined(UTF8C_STATS)
+    memset(utf8c_stats, 0, sizeof(utf8c_stats));
+#endif
+}
@@ -0,0 +1,119 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Per-thread counters of the public functions, compiled in with UTF8C_STATS. Not part of the public API.
+ * Public functions start with UTF8C_STAT_CALL, the other macros add to the counters of the function
+ * that was entered last. Without UTF8C_STATS all of them expand to nothing*/
+#ifndef UTF8C_STATS_H
+#define UTF8C_STATS_H
+
+#include "utf8c.h"
+
+/* Every instrumented function, in the order of utf8c.h. Functions picking the instruction set aren't, they run
+ * inside the first call to the kernels*/
+#define UTF8C_STAT_FUNCS(X) \
+        X(utf8_arena_init) X(utf8_arena_reset) X(utf8_arena_release) X(utf8_next) X(utf8_prior) X(utf8_advance) \
+        X(utf8_validate) X(utf8_repeat) X(utf8_repeat_n) X(utf8_repeat_a) X(utf8_distance) X(utf8_reverse) \
+        X(utf8_reverse_n) X(utf8_reverse_to) X(utf8_strcpy) X(utf8_strcpy_n) X(utf8_strcpy_a) X(utf8_substr) \
+        X(utf8_substr_n) X(utf8_substr_a) X(utf8_join) X(utf8_join_n) X(utf8_join_a) X(utf8_strcat) \
+        X(utf8_strcat_n) X(utf8_strcat_a) X(utf8_mvstrcat) X(utf8_mvstrcat_a) X(utf8_vstrcat) X(utf8_vstrcat_n) \
+        X(utf8_vstrcat_a) X(utf8_vmvstrcat) X(utf8_vmvstrcat_a) X(utf8_to_arr) X(utf8_to_arr_n) X(utf8_to_arr_a) \
+        X(utf8_to_arr_flat) X(utf8_to_arr_flat_n) X(utf8_to_arr_flat_a) X(utf8_arr_free) X(utf8_arr_free_a) \
+        X(utf8_to_str) X(utf8_to_str_n) X(utf8_to_str_a) X(utf8_index_create) X(utf8_index_create_a) \
+        X(utf8_index_free) X(utf8_index_advance) X(utf8_index_offset) X(utf8_index_substr) X(utf8_builder_init) \
+        X(utf8_builder_reserve) X(utf8_builder_append) X(utf8_builder_append_cp) X(utf8_builder_append_repeat) \
+        X(utf8_builder_append_join) X(utf8_builder_finish) X(utf8_builder_free) X(utf8_stream_init) \
+        X(utf8_stream_feed) X(utf8_stream_finish) X(utf8_utf32_len) X(utf8_utf16_len) X(utf8_len_from_utf32) \
+        X(utf8_len_from_utf16) X(utf8_to_utf32) X(utf8_to_utf16) X(utf8_from_utf32) X(utf8_from_utf16) \
+        X(utf8_view_of) X(utf8_view_n) X(utf8_view_distance) X(utf8_view_advance) X(utf8_view_substr) \
+        X(utf8_view_next) X(utf8_view_prior) X(utf8_view_next_line) X(utf8_view_str) X(utf8_view_str_a) \
+        X(utf8_split_init) X(utf8_split_init_cp) X(utf8_split_init_set) X(utf8_split_next) X(utf8_grapheme_next) \
+        X(utf8_grapheme_count) X(utf8_grapheme_to_arr) X(utf8_grapheme_to_arr_n) X(utf8_grapheme_to_arr_a) \
+        X(utf8_default_executor) X(utf8_distance_mt) X(utf8_validate_mt) X(utf8_to_utf32_mt) X(utf8_to_utf16_mt) \
+        X(utf8_from_utf32_mt) X(utf8_from_utf16_mt) X(utf8_file_open) X(utf8_file_close) X(utf8_file_view) \
+        X(utf8_file_distance) X(utf8_file_validate) X(utf8_file_substr) X(utf8_distance_batch) \
+        X(utf8_validate_batch) X(utf8_substr_batch) X(utf8_substr_into) X(utf8_join_into) X(utf8_repeat_into) \
+        X(utf8_strcat_into) X(utf8_vstrcat_into) X(utf8_to_str_into) X(utf8_is_nfc) X(utf8_is_nfd) \
+        X(utf8_is_casefolded) X(utf8_normalize_nfc) X(utf8_normalize_nfc_n) X(utf8_normalize_nfc_a) \
+        X(utf8_normalize_nfc_into) X(utf8_builder_append_nfc) X(utf8_normalize_nfd) X(utf8_normalize_nfd_n) \
+        X(utf8_normalize_nfd_a) X(utf8_normalize_nfd_into) X(utf8_builder_append_nfd) X(utf8_casefold) \
+        X(utf8_casefold_n) X(utf8_casefold_a) X(utf8_casefold_into) X(utf8_builder_append_casefold) X(utf8_find) \
+        X(utf8_rfind) X(utf8_find_cp) X(utf8_sanitize) X(utf8_sanitize_into) X(utf8_builder_append_sanitized)
+
+#define UTF8C_STAT_ID(fn) UTF8C_STAT_##fn,
+enum {
+    UTF8C_STAT_FUNCS(UTF8C_STAT_ID)
+    UTF8C_STAT_COUNT
+};
+#undef UTF8C_STAT_ID
+
+#if defined(UTF8C_STATS)
+
+#if defined(_MSC_VER)
+#define UTF8C_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define UTF8C_THREAD_LOCAL __thread
+#else
+#error "UTF8C_STATS needs thread-local storage"
+#endif
+
+/* Counters of the calling thread, `name` isn't set*/
+extern UTF8C_THREAD_LOCAL utf8_stat utf8c_stats[UTF8C_STAT_COUNT];
+
+/* Function the counters of the other macros go to*/
+extern UTF8C_THREAD_LOCAL size_t utf8c_stats_current;
+
+/* `fn`     - name of the public function being entered
+ * `n`      - number of octets of input it was passed, 0 if it's only known after measuring*/
+#define UTF8C_STAT_CALL(fn, n) \
+    (utf8c_stats_current = UTF8C_STAT_##fn, utf8c_stats[UTF8C_STAT_##fn].calls++, \
+     utf8c_stats[UTF8C_STAT_##fn].octets += (size_t) (n))
+
+/* `fn`     - name of the public function being run, after it called another one*/
+#define UTF8C_STAT_RESUME(fn) ((void) (utf8c_stats_current = UTF8C_STAT_##fn))
+
+/* return   - number of octets between `begin` and `end`, 0 if either is NULL*/
+#define UTF8C_STAT_SPAN(begin, end) \
+    (((begin) == NULL || (end) == NULL) ? 0 \
+     : ((end) > (begin)) ? (size_t) ((end) - (begin)) : (size_t) ((begin) - (end)))
+
+/* `field`  - one of the size_t counters of utf8_stat
+ * `n`      - value to add to it*/
+#define UTF8C_STAT_ADD(field, n) ((void) (utf8c_stats[utf8c_stats_current].field += (size_t) (n)))
+
+/* `str`    - \0 terminated string to measure
+ * return   - same as strlen, the octets are counted as scanned*/
+size_t utf8c_strlen(const char *str);
+
+#else
+
+#define UTF8C_STAT_CALL(fn, n) ((void) 0)
+#define UTF8C_STAT_ADD(field, n) ((void) 0)
+#define UTF8C_STAT_RESUME(fn) ((void) 0)
+#define UTF8C_STAT_SPAN(begin, end) 0
+#define utf8c_strlen(str) strlen(str)
+
+#endif /* UTF8C_STATS*/
+
+#endif /* UTF8C_STATS_H*/
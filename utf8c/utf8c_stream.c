@@ -0,0 +1,147 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_stats.h"
+
+/* Number of octets of a sequence judging by its first octet. Ill-formed lead octets make up sequences
+ * of their own length, validation rejects them anyway*/
+static size_t sequence_len(char lead) {
+    unsigned char c;
+
+    c = (unsigned char) lead;
+    if (c >= 0xF8 || c < 0xC0) {
+        return 1;
+    }
+    return (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : 2;
+}
+
+static void stream_validate(utf8_stream *stream, const char *s, size_t len, size_t off) {
+    size_t invalid;
+
+    if (stream->error_offset != utf8_npos) { /* Only the first error is reported*/
+        return;
+    }
+
+    invalid = utf8c_validate(s, len);
+    if (invalid != len) {
+        stream->error_offset = off + invalid;
+    }
+}
+
+void utf8_stream_init(utf8_stream *stream) {
+    UTF8C_STAT_CALL(utf8_stream_init, 0);
+    if (stream == NULL) {
+        errno = UTF8_EINVAL;
+        return;
+    }
+
+    stream->n_bytes = 0;
+    stream->n_cps = 0;
+    stream->error_offset = utf8_npos;
+    stream->head_len = 0;
+    stream->pending_len = 0;
+}
+
+size_t utf8_stream_feed(utf8_stream *stream, const char *chunk, size_t len) {
+    size_t need, off, cut, i;
+    char seq[8];
+
+    UTF8C_STAT_CALL(utf8_stream_feed, len);
+    if (stream == NULL || (chunk == NULL && len != 0)) {
+        errno = UTF8_EINVAL;
+        return 0;
+    }
+
+    stream->head_len = 0;
+    off = 0;
+
+    if (stream->pending_len != 0) {
+        /* Complete the sequence started by the previous chunks*/
+        need = sequence_len(stream->pending[0]) - stream->pending_len;
+        while (off < need && off < len && UTF8C_IS_CONT(chunk[off])) {
+            off++;
+        }
+
+        memcpy(seq, stream->pending, stream->pending_len);
+        memcpy(seq + stream->pending_len, chunk, off);
+        if (off == len && off < need) { /* Still incomplete*/
+            memcpy(stream->pending, seq, stream->pending_len + off);
+            stream->pending_len += off;
+            stream->n_bytes += len;
+            return 0;
+        }
+
+        stream_validate(stream, seq, stream->pending_len + off, stream->n_bytes - stream->pending_len);
+        memcpy(stream->head, stream->pending, stream->pending_len);
+        stream->head_len = stream->pending_len;
+        stream->pending_len = 0;
+    }
+
+    /* Cut off a sequence which doesn't fit into the chunk, its lead octet is among the last 3 octets*/
+    cut = len;
+    for (i = 1; i <= 3 && i <= len - off; i++) {
+        if (UTF8C_IS_LEAD(chunk[len - i])) {
+            if (sequence_len(chunk[len - i]) > i) {
+                cut = len - i;
+            }
+            break;
+        }
+    }
+
+    stream_validate(stream, chunk + off, cut - off, stream->n_bytes + off);
+    stream->n_cps += utf8c_count_leads(stream->head, stream->head_len) + utf8c_count_leads(chunk, cut);
+
+    memcpy(stream->pending, chunk + cut, len - cut);
+    stream->pending_len = len - cut;
+    stream->n_bytes += len;
+    return cut;
+}
+
+int utf8_stream_finish(utf8_stream *stream) {
+    UTF8C_STAT_CALL(utf8_stream_finish, 0);
+    if (stream == NULL) {
+        errno = UTF8_EINVAL;
+        return UTF8_EINVAL;
+    }
+
+    stream->head_len = 0;
+    if (stream->pending_len != 0) { /* Input ended in the middle of a sequence*/
+        if (stream->error_offset == utf8_npos) {
+            stream->error_offset = stream->n_bytes - stream->pending_len;
+        }
+        memcpy(stream->head, stream->pending, stream->pending_len);
+        stream->head_len = stream->pending_len;
+        stream->n_cps += utf8c_count_leads(stream->head, stream->head_len);
+        stream->pending_len = 0;
+    }
+
+    if (stream->error_offset != utf8_npos) {
+        errno = UTF8_EILSEQ;
+        return UTF8_EILSEQ;
+    }
+    return UTF8_OK;
+}
@@ -0,0 +1,118 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_stats.h"
+
+size_t utf8_utf32_len(const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_utf32_len, len);
+    if (str == NULL && len != 0) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    return utf8c_count_leads(str, len);
+}
+
+size_t utf8_utf16_len(const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_utf16_len, len);
+    if (str == NULL && len != 0) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    /* Code points of 4 octets are the ones that need a surrogate pair*/
+    return utf8c_count_leads(str, len) + utf8c_count_long_leads(str, len);
+}
+
+size_t utf8_len_from_utf32(const utf8_char32 *src, size_t n) {
+    UTF8C_STAT_CALL(utf8_len_from_utf32, 0);
+    if (src == NULL && n != 0) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    return utf8c_len_from_utf32(src, n);
+}
+
+size_t utf8_len_from_utf16(const utf8_char16 *src, size_t n) {
+    UTF8C_STAT_CALL(utf8_len_from_utf16, 0);
+    if (src == NULL && n != 0) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    return utf8c_len_from_utf16(src, n);
+}
+
+size_t utf8_to_utf32(const char *str, size_t len, utf8_char32 *dst, size_t cap) {
+    size_t res;
+
+    UTF8C_STAT_CALL(utf8_to_utf32, len);
+    if ((str == NULL && len != 0) || (dst == NULL && cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    res = utf8c_to_utf32(str, len, dst, cap);
+    UTF8C_STAT_ADD(cps, (res != utf8_npos) ? res : 0);
+    return res;
+}
+
+size_t utf8_to_utf16(const char *str, size_t len, utf8_char16 *dst, size_t cap) {
+    size_t res;
+
+    UTF8C_STAT_CALL(utf8_to_utf16, len);
+    if ((str == NULL && len != 0) || (dst == NULL && cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    res = utf8c_to_utf16(str, len, dst, cap);
+    /* Surrogate pairs make units and code points differ, the input is counted instead*/
+    UTF8C_STAT_ADD(cps, (res != utf8_npos) ? utf8c_count_leads(str, len) : 0);
+    return res;
+}
+
+size_t utf8_from_utf32(const utf8_char32 *src, size_t n, char *dst, size_t cap) {
+    size_t res;
+
+    UTF8C_STAT_CALL(utf8_from_utf32, 0);
+    if ((src == NULL && n != 0) || (dst == NULL && cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    res = utf8c_from_utf32(src, n, dst, cap);
+    UTF8C_STAT_ADD(cps, (res != utf8_npos) ? n : 0);
+    return res;
+}
+
+size_t utf8_from_utf16(const utf8_char16 *src, size_t n, char *dst, size_t cap) {
+    size_t res;
+
+    UTF8C_STAT_CALL(utf8_from_utf16, 0);
+    if ((src == NULL && n != 0) || (dst == NULL && cap != 0)) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    res = utf8c_from_utf16(src, n, dst, cap);
+    /* Surrogate pairs make units and code points differ, the output is counted instead*/
+    UTF8C_STAT_ADD(cps, (res != utf8_npos) ? utf8c_count_leads(dst, res) : 0);
+    return res;
+}
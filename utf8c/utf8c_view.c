@@ -0,0 +1,188 @@
+/*
+MIT License
+
+Copyright (c) 2020 Wirtos_new
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <string.h>
+#include <errno.h>
+#include "utf8c.h"
+#include "utf8c_simd.h"
+#include "utf8c_stats.h"
+
+/* Returned on errors, along with errno*/
+static const utf8_view null_view = {NULL, 0};
+
+static utf8_view make_view(const char *ptr, size_t len) {
+    utf8_view view;
+
+    view.ptr = ptr;
+    view.len = len;
+    return view;
+}
+
+utf8_view utf8_view_of(const char *str) {
+    UTF8C_STAT_CALL(utf8_view_of, 0);
+    if (str == NULL) {
+        errno = UTF8_EINVAL;
+        return null_view;
+    }
+    return make_view(str, utf8c_strlen(str));
+}
+
+utf8_view utf8_view_n(const char *str, size_t len) {
+    UTF8C_STAT_CALL(utf8_view_n, len);
+    if (str == NULL) {
+        errno = UTF8_EINVAL;
+        return null_view;
+    }
+    return make_view(str, len);
+}
+
+size_t utf8_view_distance(utf8_view view) {
+    size_t n;
+
+    UTF8C_STAT_CALL(utf8_view_distance, view.len);
+    if (view.ptr == NULL) {
+        errno = UTF8_EINVAL;
+        return utf8_npos;
+    }
+    n = utf8c_count_leads(view.ptr, view.len);
+    UTF8C_STAT_ADD(cps, n);
+    return n;
+}
+
+utf8_view utf8_view_advance(utf8_view view, size_t n) {
+    const char *it, *end;
+
+    UTF8C_STAT_CALL(utf8_view_advance, view.len);
+    if (view.ptr == NULL) {
+        errno = UTF8_EINVAL;
+        return null_view;
+    }
+
+    end = &view.ptr[view.len];
+    it = utf8_advance(view.ptr, n, end);
+    if (it == NULL) { /* Can't advance `n` code points, it goes beyond last code point of the view*/
+        errno = UTF8_ERANGE;
+        return null_view;
+    }
+    return make_view(it, (size_t) (end - it));
+}
+
+utf8_view utf8_view_substr(utf8_view view, size_t off, size_t count) {
+    const char *it_end, *end;
+
+    UTF8C_STAT_CALL(utf8_view_substr, view.len);
+    view = utf8_view_advance(view, off);
+    if (view.ptr == NULL) {
+        return null_view;
+    }
+
+    end = &view.ptr[view.len];
+    it_end = (count == utf8_npos)
+             ? end
+             : utf8_advance(view.ptr, count, end);
+
+    if (it_end == NULL) {
+        it_end = end; /* Count goes beyond last code point of the view, use its end*/
+    }
+    return make_view(view.ptr, (size_t) (it_end - view.ptr));
+}
+
+utf8_view utf8_view_next(utf8_view *view) {
+    size_t n;
+    utf8_view cp;
+
+    UTF8C_STAT_CALL(utf8_view_next, 0);
+    if (view == NULL || view->ptr == NULL) {
+        errno = UTF8_EINVAL;
+        return null_view;
+    }
+
+    if (view->len == 0) {
+        return make_view(view->ptr, 0);
+    }
+    n = 1;
+    while (n < view->len && UTF8C_IS_CONT(view->ptr[n])) {
+        n++;
+    }
+
+    cp = make_view(view->ptr, n);
+    view->ptr += n;
+    view->len -= n;
+    UTF8C_STAT_ADD(cps, 1);
+    return cp;
+}
+
+utf8_view utf8_view_prior(utf8_view *view) {
+    size_t n;
+    utf8_view cp;
+
+    UTF8C_STAT_CALL(utf8_view_prior, 0);
+    if (view == NULL || view->ptr == NULL) {
+        errno = UTF8_EINVAL;
+        return null_view;
+    }
+
+    if (view->len == 0) {
+        return make_view(view->ptr, 0);
+    }
+    n = view->len - 1;
+    while (n > 0 && UTF8C_IS_CONT(view->ptr[n])) {
+        n--;
+    }
+
+    cp = make_view(&view->ptr[n], view->len - n);
+    view->len = n;
+    UTF8C_STAT_ADD(cps, 1);
+    return cp;
+}
+
+utf8_view utf8_view_next_line(utf8_view *view) {
+    const char *nl;
+    size_t n;
+    utf8_view line;
+
+    UTF8C_STAT_CALL(utf8_view_next_line, 0);
+    if (view == NULL || view->ptr == NULL) {
+        errno = UTF8_EINVAL;
+        return null_view;
+    }
+
+    /* \n never occurs inside a multi-octet sequence, so a plain octet search is enough*/
+    nl = (const char *) memchr(view->ptr, '\n', view->len);
+    n = (nl != NULL) ? (size_t) (nl - view->ptr) + 1 : view->len;
+
+    line = make_view(view->ptr, n);
+    view->ptr += n;
+    view->len -= n;
+    return line;
+}
+
+char *utf8_view_str(utf8_view view, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_view_str, view.len);
+    return utf8_strcpy_a(NULL, view.ptr, view.len, out_len);
+}
+
+char *utf8_view_str_a(const utf8_allocator *alloc, utf8_view view, size_t *out_len) {
+    UTF8C_STAT_CALL(utf8_view_str_a, view.len);
+    return utf8_strcpy_a(alloc, view.ptr, view.len, out_len);
+}